@@ -0,0 +1,43 @@
+//! @file BenchmarkBounds.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <type_traits>
+#include <benchmark/benchmark.h>
+#include <UI/Bounds.hpp>
+
+namespace {
+
+template <typename BoundsType>
+void BM_BoundsLayout(benchmark::State& state) {
+    using T = std::remove_cvref_t<decltype(std::declval<BoundsType>().origin().x)>;
+    std::vector<BoundsType> bounds(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _: state) {
+        auto area = BoundsType {0, 0, static_cast<T>(4096), static_cast<T>(4096)};
+
+        for (std::size_t i = 0; i < bounds.size(); ++i) {
+            auto& item = bounds[i];
+            item.setPositionWithOrigin(area.origin());
+            item.setSizeFromOrigin(static_cast<T>(20 + i % 7), static_cast<T>(20));
+            item.translate(static_cast<T>(1), static_cast<T>(2));
+            item.setSizeFromCentre(static_cast<T>(18), static_cast<T>(18));
+            area.setPositionWithOrigin(area.origin().x + static_cast<T>(1), area.origin().y);
+        }
+
+        benchmark::DoNotOptimize(bounds.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+BENCHMARK_TEMPLATE(BM_BoundsLayout, ds::ui::Bounds<float>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_BoundsLayout, ds::ui::CompactBounds<float>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_BoundsLayout, ds::ui::Bounds<int>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_BoundsLayout, ds::ui::CompactBounds<int>)->Arg(4096);
@@ -0,0 +1,74 @@
+//! @file BenchmarkBoundsBatch.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <benchmark/benchmark.h>
+#include <UI/BoundsBatch.hpp>
+
+namespace {
+
+struct BatchBenchmarkPoints {
+    explicit BatchBenchmarkPoints(std::size_t const count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            x.push_back(static_cast<float>((i * 7919u) % 1000u));
+            y.push_back(static_cast<float>((i * 104729u) % 1000u));
+        }
+    }
+
+    std::vector<float> x;
+    std::vector<float> y;
+};
+
+void BM_ContainsEachPoint(benchmark::State& state) {
+    auto const points = BatchBenchmarkPoints(static_cast<std::size_t>(state.range(0)));
+    auto const bounds = ds::ui::Bounds<float> {100.0f, 100.0f, 500.0f, 500.0f};
+    std::vector<std::uint64_t> mask(ds::ui::getMaskWordCount(points.x.size()));
+
+    for (auto _: state) {
+        for (std::size_t i = 0; i < points.x.size(); ++i) {
+            auto const isContained = bounds.contains(ds::ui::Point {points.x[i], points.y[i]});
+            mask[i / 64] |= static_cast<std::uint64_t>(isContained) << (i % 64);
+        }
+
+        benchmark::DoNotOptimize(mask.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ContainsEachBatch(benchmark::State& state) {
+    auto const points = BatchBenchmarkPoints(static_cast<std::size_t>(state.range(0)));
+    auto const bounds = ds::ui::Bounds<float> {100.0f, 100.0f, 500.0f, 500.0f};
+    std::vector<std::uint64_t> mask(ds::ui::getMaskWordCount(points.x.size()));
+
+    for (auto _: state) {
+        ds::ui::containsEach(bounds, ds::ui::PointSpan<float> {points.x, points.y}, mask);
+        benchmark::DoNotOptimize(mask.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ContainedByEachBatch(benchmark::State& state) {
+    auto const origins = BatchBenchmarkPoints(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> const sizes(origins.x.size(), 20.0f);
+    std::vector<std::uint64_t> mask(ds::ui::getMaskWordCount(origins.x.size()));
+    auto const bounds = ds::ui::BoundsSpan<float> {origins.x, origins.y, sizes, sizes};
+
+    for (auto _: state) {
+        ds::ui::containedByEach(ds::ui::Point {500.0f, 500.0f}, bounds, mask);
+        benchmark::DoNotOptimize(mask.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+BENCHMARK(BM_ContainsEachPoint)->Arg(64)->Arg(4096);
+BENCHMARK(BM_ContainsEachBatch)->Arg(64)->Arg(4096);
+BENCHMARK(BM_ContainedByEachBatch)->Arg(64)->Arg(4096);
@@ -0,0 +1,50 @@
+//! @file BenchmarkCellSelection.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <UI/Constructs/CellSelection.hpp>
+
+namespace {
+
+//! @brief Build a selection from overlapping rectangles on a large grid, then count and visit it.
+
+void BM_CellSelectionCombine(benchmark::State& state) {
+    auto const extent = static_cast<int>(state.range(0));
+    auto selection = ds::ui::CellSelection(extent, extent);
+
+    for (auto _: state) {
+        selection.select({0, 0, extent / 2, extent / 2});
+        selection.add({extent / 4, extent / 4, extent / 2, extent / 2});
+        selection.subtract({extent / 3, 0, extent / 8, extent});
+        selection.intersect({1, 1, extent - 2, extent - 2});
+        benchmark::DoNotOptimize(selection.count());
+    }
+
+    state.counters["Cells"] = static_cast<double>(selection.count());
+}
+
+void BM_CellSelectionRuns(benchmark::State& state) {
+    auto const extent = static_cast<int>(state.range(0));
+    auto selection = ds::ui::CellSelection(extent, extent);
+
+    selection.add({0, 0, extent / 2, extent / 2});
+    selection.add({extent / 4, extent / 4, extent / 2, extent / 2});
+    selection.subtract({extent / 3, 0, extent / 8, extent});
+
+    for (auto _: state) {
+        auto runs = 0;
+        selection.forEachRun([&runs](int, int, int) {
+            ++runs;
+        });
+
+        benchmark::DoNotOptimize(runs);
+    }
+}
+
+}
+
+BENCHMARK(BM_CellSelectionCombine)->Arg(1024)->Arg(4096);
+BENCHMARK(BM_CellSelectionRuns)->Arg(1024)->Arg(4096);
@@ -0,0 +1,57 @@
+//! @file BenchmarkChannel.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <deque>
+#include <benchmark/benchmark.h>
+#include <Events/Channel.hpp>
+#include <Events/CursorEvent.hpp>
+#include <Events/EventsReceiver.hpp>
+
+namespace {
+
+struct LegacyBenchmarkReceiver: public ds::events::Receiver<ds::events::EventType::CursorEvent> {
+    void onEvent(ds::events::Event const& event) override {
+        auto const& cursorEvent = dynamic_cast<ds::ui::CursorEvent const&>(event);
+        benchmark::DoNotOptimize(sum += cursorEvent.xy.x);
+    }
+
+    int sum {0};
+};
+
+struct TypedBenchmarkReceiver: public ds::events::ChannelReceiver<TypedBenchmarkReceiver, ds::ui::CursorEvent> {
+    void onEvent(ds::ui::CursorEvent const& event) {
+        benchmark::DoNotOptimize(sum += event.xy.x);
+    }
+
+    int sum {0};
+};
+
+void BM_CursorEventThroughDispatcher(benchmark::State& state) {
+    std::deque<LegacyBenchmarkReceiver> receivers(static_cast<std::size_t>(state.range(0)));
+    auto const event = ds::ui::CursorEvent({10, 20}, false, false);
+
+    for (auto _: state) {
+        ds::events::Dispatcher::dispatch(event);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_CursorEventThroughChannel(benchmark::State& state) {
+    std::deque<TypedBenchmarkReceiver> receivers(static_cast<std::size_t>(state.range(0)));
+    auto const event = ds::ui::CursorEvent({10, 20}, false, false);
+
+    for (auto _: state) {
+        ds::events::Channel<ds::ui::CursorEvent, TypedBenchmarkReceiver>::dispatch(event);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(BM_CursorEventThroughDispatcher)->Arg(1)->Arg(10)->Arg(1000);
+BENCHMARK(BM_CursorEventThroughChannel)->Arg(1)->Arg(10)->Arg(1000);
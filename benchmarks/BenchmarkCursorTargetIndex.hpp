@@ -0,0 +1,79 @@
+//! @file BenchmarkCursorTargetIndex.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <cmath>
+#include <deque>
+#include <benchmark/benchmark.h>
+#include <Events/CursorTargetIndex.hpp>
+
+namespace {
+
+struct BenchmarkCursorTarget: public ds::ui::Bounds<float>, public ds::ui::CursorTarget {
+    BenchmarkCursorTarget(float const x, float const y):
+            ds::ui::Bounds<float>(x, y, 18.0f, 18.0f) {
+    }
+
+    [[nodiscard]] bool isCursorInBounds(ds::ui::CursorEvent const& event) const override {
+        return contains(event.xy);
+    }
+};
+
+std::deque<BenchmarkCursorTarget> makeBenchmarkCursorTargets(std::size_t const count) {
+    auto const columns = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(count))));
+    std::deque<BenchmarkCursorTarget> targets;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        targets.emplace_back(static_cast<float>(i % columns) * 20.0f,
+                             static_cast<float>(i / columns) * 20.0f);
+    }
+
+    return targets;
+}
+
+ds::ui::CursorEvent makeBenchmarkCursorEvent(std::size_t const step, std::size_t const count) {
+    auto const extent = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(count)))) * 20;
+    auto const x = static_cast<int>((step * 7919u) % static_cast<std::size_t>(extent));
+    auto const y = static_cast<int>((step * 104729u) % static_cast<std::size_t>(extent));
+
+    return {{x, y}, false, false};
+}
+
+void BM_CursorMoveExhaustive(benchmark::State& state) {
+    auto const count = static_cast<std::size_t>(state.range(0));
+    auto targets = makeBenchmarkCursorTargets(count);
+    std::size_t step = 0;
+
+    for (auto _: state) {
+        auto const event = makeBenchmarkCursorEvent(step++, count);
+        for (auto& target: targets) {
+            target.cursorMove(event);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_CursorMoveIndexed(benchmark::State& state) {
+    auto const count = static_cast<std::size_t>(state.range(0));
+    auto targets = makeBenchmarkCursorTargets(count);
+    auto index = ds::ui::CursorTargetIndex();
+    std::size_t step = 0;
+
+    for (auto& target: targets) {
+        index.insert(target);
+    }
+
+    for (auto _: state) {
+        index.route(ds::ui::CursorAction::Move, makeBenchmarkCursorEvent(step++, count));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(BM_CursorMoveExhaustive)->RangeMultiplier(10)->Range(10, 100000);
+BENCHMARK(BM_CursorMoveIndexed)->RangeMultiplier(10)->Range(10, 100000);
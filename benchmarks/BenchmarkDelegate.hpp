@@ -0,0 +1,88 @@
+//! @file BenchmarkDelegate.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <functional>
+#include <benchmark/benchmark.h>
+#include <Events/Delegate.hpp>
+#include <UI/Constructs/SliderState.hpp>
+
+namespace {
+
+template <typename Callback>
+struct BenchmarkSlider: public ds::ui::SliderState<float, Callback> {
+    explicit BenchmarkSlider(Callback&& callback):
+            ds::ui::SliderState<float, Callback>(0.0f, 0.0f, 1.0f, std::move(callback)) {
+    }
+
+    [[nodiscard]] bool isCursorInBounds(ds::ui::CursorEvent const& event) const override {
+        return true;
+    }
+
+    [[nodiscard]] float sliderOriginX() const override {
+        return 0.0f;
+    }
+
+    [[nodiscard]] float sliderWidthInPixels() const override {
+        return 1000.0f;
+    }
+};
+
+//! @brief Drag the given slider back and forth across its track, so that each drag event changes its value.
+
+template <typename Callback>
+void dragSlider(benchmark::State& state, BenchmarkSlider<Callback>& slider) {
+    auto downEvent = ds::ui::CursorEvent({0, 0}, true, false);
+    slider.cursorDown(downEvent);
+
+    auto x = 0;
+    auto step = 1;
+
+    for (auto _: state) {
+        x = x + step;
+        step = (x == 0 or x == 1000) ? -step : step;
+        slider.cursorDrag(ds::ui::CursorEvent({x, 0}, true, false));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SliderDragStdFunction(benchmark::State& state) {
+    auto value = 0.0f;
+    auto slider = BenchmarkSlider<std::function<void(float)>>([&value](float const sliderValue) {
+        value = sliderValue;
+    });
+
+    dragSlider(state, slider);
+    benchmark::DoNotOptimize(value);
+}
+
+void BM_SliderDragInlineFunction(benchmark::State& state) {
+    auto value = 0.0f;
+    auto slider = BenchmarkSlider<ds::events::InlineFunction<void(float)>>([&value](float const sliderValue) {
+        value = sliderValue;
+    });
+
+    dragSlider(state, slider);
+    benchmark::DoNotOptimize(value);
+}
+
+void BM_SliderDragInlinedCallable(benchmark::State& state) {
+    auto value = 0.0f;
+    auto callback = [&value](float const sliderValue) {
+        value = sliderValue;
+    };
+
+    auto slider = BenchmarkSlider<decltype(callback)>(std::move(callback));
+
+    dragSlider(state, slider);
+    benchmark::DoNotOptimize(value);
+}
+
+}
+
+BENCHMARK(BM_SliderDragStdFunction);
+BENCHMARK(BM_SliderDragInlineFunction);
+BENCHMARK(BM_SliderDragInlinedCallable);
@@ -0,0 +1,70 @@
+//! @file BenchmarkDispatcher.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <Events/EventsDispatcher.hpp>
+#include <Events/ConcurrentDispatcher.hpp>
+
+namespace {
+
+constexpr int DispatchBenchmarkEvent {2001};
+
+struct DispatchBenchmarkReceiver: public ds::events::ReceiverInterface {
+    void onEvent(ds::events::Event const& event) override {
+        benchmark::DoNotOptimize(++count);
+    }
+
+    int count {0};
+};
+
+template <typename EventDispatcher>
+void BM_Dispatch(benchmark::State& state) {
+    auto const receiverCount = static_cast<std::size_t>(state.range(0));
+    std::vector<DispatchBenchmarkReceiver> receivers(receiverCount);
+
+    for (auto& receiver: receivers) {
+        EventDispatcher::subscribe(DispatchBenchmarkEvent, &receiver);
+    }
+
+    auto const event = ds::events::Event(DispatchBenchmarkEvent);
+    for (auto _: state) {
+        EventDispatcher::dispatch(event);
+    }
+
+    for (auto& receiver: receivers) {
+        EventDispatcher::unsubscribe(DispatchBenchmarkEvent, &receiver);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//! @brief Subscribe and then unsubscribe each of a set of receivers, as components that are created and destroyed do.
+
+template <typename EventDispatcher>
+void BM_SubscriptionChurn(benchmark::State& state) {
+    auto const receiverCount = static_cast<std::size_t>(state.range(0));
+    std::vector<DispatchBenchmarkReceiver> receivers(receiverCount);
+
+    for (auto _: state) {
+        for (auto& receiver: receivers) {
+            EventDispatcher::subscribe(DispatchBenchmarkEvent, &receiver);
+        }
+
+        for (auto& receiver: receivers) {
+            EventDispatcher::unsubscribe(DispatchBenchmarkEvent, &receiver);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+BENCHMARK_TEMPLATE(BM_Dispatch, ds::events::Dispatcher)->Arg(1)->Arg(10)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_Dispatch, ds::events::ConcurrentDispatcher)->Arg(1)->Arg(10)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_SubscriptionChurn, ds::events::Dispatcher)->Arg(10)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_SubscriptionChurn, ds::events::ConcurrentDispatcher)->Arg(10)->Arg(1000);
@@ -0,0 +1,119 @@
+//! @file BenchmarkGrid.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <Events/CursorTarget.hpp>
+#include <UI/Components/Grid.hpp>
+#include <UI/Constructs/MarqueeSelection.hpp>
+
+namespace {
+
+struct BenchmarkGrid: public ds::ui::Grid {
+    BenchmarkGrid(int const rows, int const columns):
+            ds::ui::Grid(rows, columns) {
+    }
+
+    void draw(float const offsetX, float const offsetY) override {
+    }
+};
+
+//! @brief A grid that builds a marquee selection as the cursor is dragged across it, as `RuledGridWithSelection` does.
+
+struct BenchmarkSelectionGrid: public BenchmarkGrid, public ds::ui::CursorTarget {
+    BenchmarkSelectionGrid(int const rows, int const columns):
+            BenchmarkGrid(rows, columns) {
+    }
+
+    [[nodiscard]] bool isCursorInBounds(ds::ui::CursorEvent const& event) const override {
+        return contains(event.xy);
+    }
+
+    void targetWasPressed(ds::ui::CursorEvent const& event) override {
+        selection.resetSelection();
+        selection.buildSelection(getGridPositionAtPoint(event.xy));
+    }
+
+    void cursorDidDrag(ds::ui::CursorEvent const& event) override {
+        if (isBeingPressed()) {
+            selection.buildSelection(getGridPositionAtPoint(event.xy));
+        }
+    }
+
+    ds::ui::MarqueeSelection selection;
+};
+
+//! @brief Make a path of cursor positions that sweeps back and forth across a grid of 64 by 64 cells.
+
+std::vector<ds::ui::Point<int>> makeBenchmarkCursorPath(std::size_t const count) {
+    std::vector<ds::ui::Point<int>> path;
+    path.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        path.emplace_back(static_cast<int>((i * 37u) % 1300u), static_cast<int>((i * 53u) % 1300u));
+    }
+
+    return path;
+}
+
+void BM_GridPositionAtPoint(benchmark::State& state) {
+    auto grid = BenchmarkGrid(64, 64);
+    auto const path = makeBenchmarkCursorPath(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _: state) {
+        for (auto const& point: path) {
+            benchmark::DoNotOptimize(grid.getGridPositionAtPoint(point));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_MarqueeBuildSelection(benchmark::State& state) {
+    auto grid = BenchmarkGrid(64, 64);
+    auto selection = ds::ui::MarqueeSelection();
+    auto const path = makeBenchmarkCursorPath(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _: state) {
+        selection.resetSelection();
+
+        for (auto const& point: path) {
+            selection.buildSelection(grid.getGridPositionAtPoint(point));
+        }
+
+        benchmark::DoNotOptimize(selection.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//! @brief Press a selection grid, drag across it and release it through `CursorTarget::cursorAction`.
+
+void BM_CursorTargetDragChain(benchmark::State& state) {
+    using ds::ui::CursorAction;
+
+    auto grid = BenchmarkSelectionGrid(64, 64);
+    auto const path = makeBenchmarkCursorPath(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _: state) {
+        grid.cursorAction(CursorAction::Down, {path.front(), true, false});
+
+        for (auto const& point: path) {
+            grid.cursorAction(CursorAction::Drag, {point, true, false});
+        }
+
+        grid.cursorAction(CursorAction::Up, {path.back(), false, false});
+        benchmark::DoNotOptimize(grid.selection.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * (state.range(0) + 2));
+}
+
+}
+
+BENCHMARK(BM_GridPositionAtPoint)->Arg(1024);
+BENCHMARK(BM_MarqueeBuildSelection)->Arg(1024);
+BENCHMARK(BM_CursorTargetDragChain)->Arg(1024);
@@ -0,0 +1,102 @@
+//! @file BenchmarkGridGeometry.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <future>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <UI/Geometry/GridLines.hpp>
+#include <Concurrency/WorkStealingPool.hpp>
+
+namespace {
+
+//! @brief The layouts of the given number of large grids that a window resize has invalidated at once.
+
+std::vector<ds::ui::GridLineLayout> getInvalidatedLayouts(int const gridCount) {
+    std::vector<ds::ui::GridLineLayout> layouts;
+    for (auto i = 0; i < gridCount; ++i) {
+        auto const rows = 2048 + i;
+        auto const columns = 2048 - i;
+        layouts.push_back({rows, columns, static_cast<std::size_t>(rows + 1), static_cast<std::size_t>(columns + 1)});
+    }
+
+    return layouts;
+}
+
+void BM_GridGeometryOnRenderThread(benchmark::State& state) {
+    auto const layouts = getInvalidatedLayouts(static_cast<int>(state.range(0)));
+
+    for (auto _: state) {
+        for (auto const& layout: layouts) {
+            auto geometry = ds::ui::generateGridLines(layout);
+            benchmark::DoNotOptimize(geometry.vertices.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_GridGeometryOnPool(benchmark::State& state) {
+    auto const layouts = getInvalidatedLayouts(static_cast<int>(state.range(0)));
+    auto pool = ds::concurrency::WorkStealingPool();
+
+    std::vector<std::future<ds::ui::GridLineGeometry>> results;
+    results.reserve(layouts.size());
+
+    for (auto _: state) {
+        for (auto const& layout: layouts) {
+            results.push_back(pool.submit([layout] {
+                return ds::ui::generateGridLines(layout);
+            }));
+        }
+
+        for (auto& result: results) {
+            auto geometry = result.get();
+            benchmark::DoNotOptimize(geometry.vertices.data());
+        }
+
+        results.clear();
+    }
+
+    state.counters["Threads"] = static_cast<double>(pool.getThreadCount());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//! @brief Time only what the render thread spends submitting the layouts, since it does not wait for the geometry.
+//! @note The pool's workers still compete with the render thread for the cores while the submissions are timed.
+
+void BM_GridGeometrySubmitToPool(benchmark::State& state) {
+    auto const layouts = getInvalidatedLayouts(static_cast<int>(state.range(0)));
+    auto pool = ds::concurrency::WorkStealingPool();
+
+    std::vector<std::future<ds::ui::GridLineGeometry>> results;
+    results.reserve(layouts.size());
+
+    for (auto _: state) {
+        for (auto const& layout: layouts) {
+            results.push_back(pool.submit([layout] {
+                return ds::ui::generateGridLines(layout);
+            }));
+        }
+
+        state.PauseTiming();
+        for (auto& result: results) {
+            auto geometry = result.get();
+            benchmark::DoNotOptimize(geometry.vertices.data());
+        }
+
+        results.clear();
+        state.ResumeTiming();
+    }
+
+    state.counters["Threads"] = static_cast<double>(pool.getThreadCount());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+BENCHMARK(BM_GridGeometryOnRenderThread)->Arg(48)->UseRealTime();
+BENCHMARK(BM_GridGeometryOnPool)->Arg(48)->UseRealTime();
+BENCHMARK(BM_GridGeometrySubmitToPool)->Arg(48)->UseRealTime();
@@ -0,0 +1,90 @@
+//! @file BenchmarkLayout.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <UI/Layout.hpp>
+
+namespace {
+
+//! @brief Build a layout of 5,000 nodes: a column of 50 fixed-height rows, each holding 99 mixed cells.
+
+ds::ui::Layout buildLayoutTree(std::vector<ds::ui::Layout::NodeId>& leaves) {
+    using ds::ui::LayoutSize;
+
+    auto layout = ds::ui::Layout();
+    for (auto row = 0; row < 50; ++row) {
+        auto const node = layout.add(ds::ui::Layout::root, LayoutSize::cells(2), ds::ui::LayoutDirection::Row);
+        layout.setGap(node, 2.0f);
+
+        for (auto cell = 0; cell < 99; ++cell) {
+            auto const size = cell % 3 == 0 ? LayoutSize::fixed(12.0f) :
+                              cell % 3 == 1 ? LayoutSize::fraction(0.005f) :
+                              LayoutSize::flex(static_cast<float>(1 + cell % 4));
+            leaves.push_back(layout.add(node, size));
+        }
+    }
+
+    return layout;
+}
+
+void BM_LayoutResizeWidth(benchmark::State& state) {
+    std::vector<ds::ui::Layout::NodeId> leaves;
+    auto layout = buildLayoutTree(leaves);
+    layout.solve({0.0f, 0.0f, 1280.0f, 2100.0f});
+
+    auto width = 1280.0f;
+    auto solved = std::size_t {0};
+
+    for (auto _: state) {
+        width = width == 1280.0f ? 1281.0f : 1280.0f;
+        solved = solved + layout.solve({0.0f, 0.0f, width, 2100.0f});
+    }
+
+    state.counters["NodesSolved"] = benchmark::Counter(static_cast<double>(solved), benchmark::Counter::kAvgIterations);
+    state.counters["Nodes"] = static_cast<double>(layout.size());
+}
+
+void BM_LayoutResizeHeight(benchmark::State& state) {
+    std::vector<ds::ui::Layout::NodeId> leaves;
+    auto layout = buildLayoutTree(leaves);
+    layout.solve({0.0f, 0.0f, 1280.0f, 2100.0f});
+
+    auto height = 2100.0f;
+    auto solved = std::size_t {0};
+
+    for (auto _: state) {
+        height = height == 2100.0f ? 2101.0f : 2100.0f;
+        solved = solved + layout.solve({0.0f, 0.0f, 1280.0f, height});
+    }
+
+    state.counters["NodesSolved"] = benchmark::Counter(static_cast<double>(solved), benchmark::Counter::kAvgIterations);
+    state.counters["Nodes"] = static_cast<double>(layout.size());
+}
+
+void BM_LayoutConstraintChange(benchmark::State& state) {
+    std::vector<ds::ui::Layout::NodeId> leaves;
+    auto layout = buildLayoutTree(leaves);
+    layout.solve({0.0f, 0.0f, 1280.0f, 2100.0f});
+
+    auto toggle = false;
+    auto solved = std::size_t {0};
+
+    for (auto _: state) {
+        toggle = not toggle;
+        layout.setSize(leaves[leaves.size() / 2], ds::ui::LayoutSize::fixed(toggle ? 16.0f : 12.0f));
+        solved = solved + layout.solve({0.0f, 0.0f, 1280.0f, 2100.0f});
+    }
+
+    state.counters["NodesSolved"] = benchmark::Counter(static_cast<double>(solved), benchmark::Counter::kAvgIterations);
+    state.counters["Nodes"] = static_cast<double>(layout.size());
+}
+
+}
+
+BENCHMARK(BM_LayoutResizeWidth);
+BENCHMARK(BM_LayoutResizeHeight);
+BENCHMARK(BM_LayoutConstraintChange);
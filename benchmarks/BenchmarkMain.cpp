@@ -0,0 +1,19 @@
+//! @file BenchmarkMain.cpp
+//! @author David Spry
+
+#include <benchmark/benchmark.h>
+#include "BenchmarkDispatcher.hpp"
+#include "BenchmarkChannel.hpp"
+#include "BenchmarkCursorTargetIndex.hpp"
+#include "BenchmarkBounds.hpp"
+#include "BenchmarkBoundsBatch.hpp"
+#include "BenchmarkNumberFormat.hpp"
+#include "BenchmarkRecordingRenderer.hpp"
+#include "BenchmarkProfiler.hpp"
+#include "BenchmarkGrid.hpp"
+#include "BenchmarkCellSelection.hpp"
+#include "BenchmarkDelegate.hpp"
+#include "BenchmarkGridGeometry.hpp"
+#include "BenchmarkLayout.hpp"
+
+BENCHMARK_MAIN();
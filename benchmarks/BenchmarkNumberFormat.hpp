@@ -0,0 +1,51 @@
+//! @file BenchmarkNumberFormat.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <string>
+#include <iomanip>
+#include <sstream>
+#include <benchmark/benchmark.h>
+#include <UI/Constructs/NumberFormat.hpp>
+
+namespace {
+
+void BM_NumberFormatStringStream(benchmark::State& state) {
+    std::stringstream valueString;
+    std::string text;
+    auto value = 0.0f;
+
+    for (auto _: state) {
+        valueString.str("");
+        valueString << std::fixed << std::setprecision(2);
+        valueString << value;
+        text = valueString.str();
+
+        benchmark::DoNotOptimize(text.data());
+        value = value + 0.013f;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_NumberFormatToChars(benchmark::State& state) {
+    auto format = ds::ui::NumberFormat<float>(2);
+    auto value = 0.0f;
+
+    for (auto _: state) {
+        auto const didChange = format.format(value);
+
+        benchmark::DoNotOptimize(didChange);
+        benchmark::DoNotOptimize(format.view().data());
+        value = value + 0.013f;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(BM_NumberFormatStringStream);
+BENCHMARK(BM_NumberFormatToChars);
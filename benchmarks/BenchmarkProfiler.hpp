@@ -0,0 +1,33 @@
+//! @file BenchmarkProfiler.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <Profiling/Profiler.hpp>
+
+namespace {
+
+//! @brief Measure the cost of timing one span of work and recording it into the profiler's ring.
+
+void BM_ProfilerScopedSample(benchmark::State& state) {
+    auto profiler = ds::profiling::Profiler();
+    auto iterations = std::size_t {0};
+
+    for (auto _: state) {
+        {
+            ds::profiling::ScopedSample sample("Button", ds::profiling::Phase::Draw, profiler);
+            benchmark::ClobberMemory();
+        }
+
+        // Drain the ring periodically, as the application would once per frame.
+        if (++iterations % 1024 == 0) {
+            profiler.clear();
+        }
+    }
+}
+
+}
+
+BENCHMARK(BM_ProfilerScopedSample);
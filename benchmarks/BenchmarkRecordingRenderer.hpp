@@ -0,0 +1,74 @@
+//! @file BenchmarkRecordingRenderer.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <UI/Geometry/ButtonInstances.hpp>
+#include <UI/Rendering/ComponentCommands.hpp>
+#include <UI/Rendering/RecordingRenderer.hpp>
+
+namespace {
+
+//! @brief Record a frame of hovered buttons drawn one at a time, through the command sequences that `Button` draws with.
+
+void BM_RecordButtonsIndividually(benchmark::State& state) {
+    auto recorder = ds::ui::RecordingRenderer();
+    ds::ui::Renderer& renderer = recorder;
+    auto const fill = 0;
+    auto const rules = 0;
+    auto const offset = ds::ui::Point {0.0f, 0.0f};
+    auto const uniforms = ds::ui::commands::RuleUniforms {1.0f, {960.0f, 960.0f}, {20.0f, 20.0f}, {1, 1}};
+
+    for (auto _: state) {
+        recorder.clear();
+
+        for (auto i = 0; i < state.range(0); ++i) {
+            auto const origin = ds::ui::Point {static_cast<float>(i % 40) * 24.0f, static_cast<float>(i / 40) * 24.0f};
+
+            ds::ui::commands::drawButtonFills(renderer, &fill, offset, origin, {0.3f, 0.8f, 0.6f}, {true, true, false});
+            ds::ui::commands::drawRuledGrid(renderer, &rules, offset, origin, uniforms, [&] {
+                ds::ui::commands::drawOutlineRules(renderer, &rules);
+            });
+        }
+
+        benchmark::DoNotOptimize(recorder.getCommands().data());
+    }
+
+    state.counters["DrawCalls"] = static_cast<double>(recorder.statistics().drawCalls);
+    state.counters["StateChanges"] = static_cast<double>(recorder.statistics().stateChanges);
+    state.counters["TransformPushes"] = static_cast<double>(recorder.statistics().transformPushes);
+}
+
+//! @brief Record a frame of the same buttons drawn through a `ButtonInstances` buffer.
+
+void BM_RecordButtonsInstanced(benchmark::State& state) {
+    auto recorder = ds::ui::RecordingRenderer();
+    ds::ui::Renderer& renderer = recorder;
+    auto instances = ds::ui::ButtonInstances({0.0f, 0.0f, 4096.0f, 4096.0f});
+    auto const quads = 0;
+
+    for (auto _: state) {
+        recorder.clear();
+        instances.clear();
+
+        for (auto i = 0; i < state.range(0); ++i) {
+            auto const x = static_cast<float>(i % 40) * 24.0f;
+            auto const y = static_cast<float>(i / 40) * 24.0f;
+            instances.add({x, y, 20.0f, 20.0f}, {0.0f, 0.0f}, {true, true, false, {0.3f, 0.8f, 0.6f, 1.0f}, 1.0f});
+        }
+
+        renderer.drawInstanced(&quads, static_cast<int>(instances.getInstances().size()));
+        benchmark::DoNotOptimize(instances.getInstances().data());
+    }
+
+    state.counters["DrawCalls"] = static_cast<double>(recorder.statistics().drawCalls);
+    state.counters["StateChanges"] = static_cast<double>(recorder.statistics().stateChanges);
+    state.counters["TransformPushes"] = static_cast<double>(recorder.statistics().transformPushes);
+}
+
+}
+
+BENCHMARK(BM_RecordButtonsIndividually)->Arg(500);
+BENCHMARK(BM_RecordButtonsInstanced)->Arg(500);
@@ -0,0 +1,137 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "ParameterBridge.hpp"
+
+#include <algorithm>
+
+namespace ds::concurrency {
+
+ParameterBridge::ParameterBridge():
+        ring(std::make_unique<SpscRing<ParameterUpdate, Capacity>>()) {
+}
+
+bool ParameterBridge::publish(std::uint32_t const parameter, float const value) {
+    return publish({parameter, value, now()});
+}
+
+bool ParameterBridge::publish(ParameterUpdate const& update) {
+    // An update may only be pushed once every update before it has been pushed.
+    if (flush() and ring->push(update)) {
+        return true;
+    }
+
+    addToBacklog(update);
+
+    return false;
+}
+
+bool ParameterBridge::flush() {
+    auto pushed = std::size_t {0};
+    while (pushed < backlogSize and ring->push(backlog[pushed])) {
+        pushed = pushed + 1;
+    }
+
+    std::copy(backlog.begin() + pushed, backlog.begin() + backlogSize, backlog.begin());
+    backlogSize = backlogSize - pushed;
+
+    return backlogSize == 0;
+}
+
+void ParameterBridge::addToBacklog(ParameterUpdate const& update) {
+    auto const first = backlog.begin();
+    auto const last = backlog.begin() + backlogSize;
+
+    // A newer value replaces the parameter's waiting value and moves to the back, so the backlog stays in order.
+    if (auto const waiting = std::find_if(first, last, [&update](ParameterUpdate const& other) {
+            return other.parameter == update.parameter;
+        }); waiting != last) {
+        std::copy(waiting + 1, last, waiting);
+        backlog[backlogSize - 1] = update;
+    } else if (backlogSize < BacklogCapacity) {
+        backlog[backlogSize] = update;
+        backlogSize = backlogSize + 1;
+    } else {
+        droppedCount = droppedCount + 1;
+    }
+}
+
+std::size_t ParameterBridge::receive(ParameterUpdate* const block, std::size_t const capacity) {
+    auto count = std::size_t {0};
+    while (count < capacity and ring->pop(block[count])) {
+        count = count + 1;
+    }
+
+    return count;
+}
+
+std::int64_t ParameterBridge::now() {
+    auto const time = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+}
+
+LinearSmoother::LinearSmoother(float const initialValue):
+        current(initialValue),
+        target(initialValue) {
+}
+
+void LinearSmoother::reset(float const newValue) {
+    current = newValue;
+    target = newValue;
+    remaining = 0;
+}
+
+void LinearSmoother::setTarget(float const newTarget, std::uint32_t const steps) {
+    if (steps == 0) {
+        return reset(newTarget);
+    }
+
+    target = newTarget;
+    remaining = steps;
+    increment = (target - current) / static_cast<float>(steps);
+}
+
+float LinearSmoother::skip(std::uint32_t const steps) {
+    if (steps >= remaining) {
+        current = target;
+        remaining = 0;
+    } else {
+        current = current + increment * static_cast<float>(steps);
+        remaining = remaining - steps;
+    }
+
+    return current;
+}
+
+ParameterBank::ParameterBank(std::size_t const parameterCount):
+        parameters(parameterCount) {
+}
+
+void ParameterBank::setSmoothing(std::uint32_t const parameter, std::uint32_t const steps) {
+    if (parameter < parameters.size()) {
+        parameters[parameter].steps = steps;
+    }
+}
+
+void ParameterBank::apply(ParameterUpdate const& update) {
+    if (update.parameter < parameters.size()) {
+        auto& entry = parameters[update.parameter];
+        entry.smoother.setTarget(update.value, entry.steps);
+    }
+}
+
+std::size_t ParameterBank::update(ParameterBridge& bridge) {
+    return bridge.drain([this](ParameterUpdate const& update) {
+        apply(update);
+    });
+}
+
+void ParameterBank::advance(std::uint32_t const steps) {
+    for (auto& parameter: parameters) {
+        if (parameter.smoother.isSmoothing()) {
+            parameter.smoother.skip(steps);
+        }
+    }
+}
+
+}
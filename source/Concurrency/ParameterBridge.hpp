@@ -0,0 +1,273 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "SpscRing.hpp"
+
+namespace ds::concurrency {
+
+//! @struct A change to the value of a parameter, stamped with the time at which it was published.
+//! @note The timestamp is in nanoseconds on the steady clock, so the worker can place each change within its block.
+
+struct ParameterUpdate {
+    std::uint32_t parameter {0};
+    float value {0.0f};
+    std::int64_t timestamp {0};
+};
+
+//! @class A one-way channel of parameter updates from the UI thread to a worker thread, such as an audio thread.
+//! @note Updates are passed through a wait-free, single-producer, single-consumer ring, so neither thread blocks.
+//! If the ring is full, the UI thread keeps the update in a fixed-capacity backlog that holds the latest value of
+//! each parameter, and retries the backlog before publishing the next update or whenever it is flushed. Updates
+//! arrive in the order in which they were published, except that a burst that overflows the ring is reduced to the
+//! last value of each parameter, so the worker always ends at the value that the UI thread published last.
+
+class ParameterBridge {
+public:
+    static constexpr std::size_t Capacity = 4096;
+    static constexpr std::size_t BacklogCapacity = 256;
+
+public:
+    ParameterBridge();
+
+    ParameterBridge(ParameterBridge const&) = delete;
+    ParameterBridge& operator=(ParameterBridge const&) = delete;
+
+public:
+    //! @brief Publish a change to the given parameter. This should only be called by the UI thread.
+    //! @param parameter The identifier of the parameter.
+    //! @param value The parameter's new value.
+    //! @return Whether the update, and every update before it, has been passed to the worker.
+
+    bool publish(std::uint32_t parameter, float value);
+
+    //! @brief Publish the given update. This should only be called by the UI thread.
+    //! @param update The update to be published.
+    //! @return Whether the update, and every update before it, has been passed to the worker.
+
+    bool publish(ParameterUpdate const& update);
+
+    //! @brief Retry the updates that did not fit in the ring. This should only be called by the UI thread.
+    //! @note Controls bound to a parameter call this each time they are drawn, so the backlog reaches the worker once
+    //! the ring has room, even if nothing else is published. A host that publishes directly should call it once per
+    //! frame.
+    //! @return Whether every update has been passed to the worker.
+
+    bool flush();
+
+    //! @brief Get the number of updates waiting to be retried. This should only be called by the UI thread.
+
+    [[nodiscard]] inline std::size_t getBacklogSize() const {
+        return backlogSize;
+    }
+
+    //! @brief Get the number of updates that were discarded because the backlog held `BacklogCapacity` other
+    //! parameters. This should only be called by the UI thread.
+
+    [[nodiscard]] inline std::size_t getDroppedCount() const {
+        return droppedCount;
+    }
+
+public:
+    //! @brief Move up to the given number of updates into the given block. This should only be called by the worker.
+    //! @param block The block to be written to.
+    //! @param capacity The number of updates that the block can hold.
+    //! @return The number of updates written.
+
+    std::size_t receive(ParameterUpdate* block, std::size_t capacity);
+
+    //! @brief Pass each pending update to the given handler, in order. This should only be called by the worker.
+    //! @param handler A callable with the signature `void(ParameterUpdate const&)`.
+    //! @param maximum The maximum number of updates to be handled.
+    //! @return The number of updates handled.
+
+    template <typename Handler>
+    std::size_t drain(Handler&& handler, std::size_t const maximum = std::numeric_limits<std::size_t>::max()) {
+        auto update = ParameterUpdate {};
+        auto count = std::size_t {0};
+
+        while (count < maximum and ring->pop(update)) {
+            handler(update);
+            count = count + 1;
+        }
+
+        return count;
+    }
+
+public:
+    //! @brief Get the current time in nanoseconds on the clock used to stamp updates.
+
+    [[nodiscard]] static std::int64_t now();
+
+private:
+    void addToBacklog(ParameterUpdate const& update);
+
+private:
+    std::unique_ptr<SpscRing<ParameterUpdate, Capacity>> ring;
+    std::array<ParameterUpdate, BacklogCapacity> backlog {};
+    std::size_t backlogSize {0};
+    std::size_t droppedCount {0};
+};
+
+//! @struct A connection from a UI control to one parameter of a `ParameterBridge`.
+
+struct ParameterBinding {
+    ParameterBridge* bridge {nullptr};
+    std::uint32_t parameter {0};
+
+public:
+    //! @brief Publish the given value if the binding is connected.
+    //! @param value The parameter's new value.
+
+    template <typename T>
+    inline void publish(T const value) const {
+        if (bridge != nullptr) {
+            bridge->publish(parameter, static_cast<float>(value));
+        }
+    }
+
+    //! @brief Retry the bridge's backlog if the binding is connected.
+
+    inline void flush() const {
+        if (bridge != nullptr) {
+            bridge->flush();
+        }
+    }
+};
+
+//! @class A value that moves linearly towards its target over a given number of steps, such as audio samples.
+
+class LinearSmoother {
+public:
+    //! @brief Create a smoother that rests at the given value.
+    //! @param initialValue The initial value.
+
+    explicit LinearSmoother(float initialValue = 0.0f);
+
+public:
+    //! @brief Jump to the given value without ramping.
+    //! @param newValue The desired value.
+
+    void reset(float newValue);
+
+    //! @brief Ramp to the given value from the current value.
+    //! @param newTarget The value to ramp to.
+    //! @param steps The number of steps the ramp should take, or 0 to jump to the target.
+
+    void setTarget(float newTarget, std::uint32_t steps);
+
+    //! @brief Advance the ramp by one step and return the new value.
+
+    inline float next() {
+        if (remaining > 0) {
+            remaining = remaining - 1;
+            current = remaining == 0 ? target : current + increment;
+        }
+
+        return current;
+    }
+
+    //! @brief Advance the ramp by the given number of steps and return the new value.
+    //! @param steps The number of steps to advance by.
+
+    float skip(std::uint32_t steps);
+
+public:
+    //! @brief Get the current value.
+
+    [[nodiscard]] inline float getValue() const {
+        return current;
+    }
+
+    //! @brief Get the value being ramped to.
+
+    [[nodiscard]] inline float getTarget() const {
+        return target;
+    }
+
+    //! @brief Indicate whether the value is still ramping.
+
+    [[nodiscard]] inline bool isSmoothing() const {
+        return remaining > 0;
+    }
+
+private:
+    float current;
+    float target;
+    float increment {0.0f};
+    std::uint32_t remaining {0};
+};
+
+//! @class The worker's view of a set of parameters, each of which may be smoothed.
+//! @note The bank is owned and used by the worker alone. Parameters are identified by their index.
+
+class ParameterBank {
+public:
+    //! @brief Create a bank of the given number of parameters, each of which is initially 0 and unsmoothed.
+    //! @param parameterCount The number of parameters.
+
+    explicit ParameterBank(std::size_t parameterCount);
+
+public:
+    //! @brief Set the number of steps over which changes to the given parameter are ramped.
+    //! @param parameter The identifier of the parameter.
+    //! @param steps The length of each ramp, or 0 to apply changes immediately.
+
+    void setSmoothing(std::uint32_t parameter, std::uint32_t steps);
+
+    //! @brief Apply the given update. Updates to parameters outside the bank are ignored.
+    //! @param update The update to be applied.
+
+    void apply(ParameterUpdate const& update);
+
+    //! @brief Apply every pending update of the given bridge, in order.
+    //! @param bridge The bridge to be drained.
+    //! @return The number of updates applied.
+
+    std::size_t update(ParameterBridge& bridge);
+
+    //! @brief Advance every ramping parameter by the given number of steps.
+    //! @param steps The number of steps to advance by.
+
+    void advance(std::uint32_t steps);
+
+public:
+    //! @brief Get the current value of the given parameter.
+    //! @param parameter The identifier of the parameter.
+
+    [[nodiscard]] inline float getValue(std::uint32_t const parameter) const {
+        return parameters[parameter].smoother.getValue();
+    }
+
+    //! @brief Get the smoother of the given parameter, so that it can be advanced step by step.
+    //! @param parameter The identifier of the parameter.
+
+    [[nodiscard]] inline LinearSmoother& getSmoother(std::uint32_t const parameter) {
+        return parameters[parameter].smoother;
+    }
+
+    //! @brief Get the number of parameters in the bank.
+
+    [[nodiscard]] inline std::size_t size() const {
+        return parameters.size();
+    }
+
+private:
+    struct Parameter {
+        LinearSmoother smoother {};
+        std::uint32_t steps {0};
+    };
+
+private:
+    std::vector<Parameter> parameters;
+};
+
+}
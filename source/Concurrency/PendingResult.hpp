@@ -0,0 +1,68 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <chrono>
+#include <future>
+#include <utility>
+#include <optional>
+#include <Concurrency/WorkStealingPool.hpp>
+
+namespace ds::concurrency {
+
+//! @class The result of the most recent task that a component requested from a pool, collected without blocking.
+//! @note Requesting a new task supersedes the previous one, so a stale result is discarded rather than taken,
+//! even if its task is still running.
+
+template <typename T>
+class PendingResult {
+public:
+    //! @brief Run the given task on the given pool, superseding any pending task.
+    //! @param pool The pool that should run the task.
+    //! @param task A callable that takes no arguments and returns a `T`.
+
+    template <typename Task>
+    void request(WorkStealingPool& pool, Task&& task) {
+        future = pool.submit(std::forward<Task>(task));
+    }
+
+    //! @brief Take the result of the pending task if it has finished.
+    //! @return The result, or nothing if no task is pending or the pending task has not finished.
+
+    std::optional<T> take() {
+        if (future.valid() and future.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            return future.get();
+        }
+
+        return std::nullopt;
+    }
+
+    //! @brief Wait for the pending task to finish and take its result.
+    //! @return The result, or nothing if no task is pending.
+
+    std::optional<T> wait() {
+        if (future.valid()) {
+            return future.get();
+        }
+
+        return std::nullopt;
+    }
+
+    //! @brief Discard the pending task's result.
+
+    inline void cancel() {
+        future = {};
+    }
+
+    //! @brief Indicate whether a task has been requested and its result has not yet been taken.
+
+    [[nodiscard]] inline bool isPending() const {
+        return future.valid();
+    }
+
+private:
+    std::future<T> future;
+};
+
+}
@@ -0,0 +1,77 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace ds::concurrency {
+
+//! @class A bounded, lock-free ring buffer with a single producer and a single consumer.
+//! @note Both `push` and `pop` are wait-free, and neither allocates. When the ring is full, `push` returns false
+//! without writing, so that a slow consumer cannot stall the producer.
+
+template <typename T, std::size_t Capacity>
+class SpscRing {
+public:
+    static_assert(Capacity > 0 and (Capacity & (Capacity - 1)) == 0, "The capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "The ring's values must be trivially copyable");
+
+public:
+    //! @brief Append the given value to the ring. This should only be called by the producer.
+    //! @param value The value to be appended.
+    //! @return Whether the value was appended, which is false if the ring is full.
+
+    inline bool push(T const& value) {
+        auto const head = writeIndex.load(std::memory_order_relaxed);
+        if (head - readIndex.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+
+        values[head & (Capacity - 1)] = value;
+        writeIndex.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    //! @brief Remove the oldest value from the ring. This should only be called by the consumer.
+    //! @param value The value to be written to.
+    //! @return Whether a value was removed, which is false if the ring is empty.
+
+    inline bool pop(T& value) {
+        auto const tail = readIndex.load(std::memory_order_relaxed);
+        if (tail == writeIndex.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        value = values[tail & (Capacity - 1)];
+        readIndex.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+public:
+    //! @brief Get the number of values in the ring, which may be stale by the time it is returned.
+
+    [[nodiscard]] inline std::size_t size() const {
+        return writeIndex.load(std::memory_order_acquire) - readIndex.load(std::memory_order_acquire);
+    }
+
+    //! @brief Get the maximum number of values that the ring can hold.
+
+    [[nodiscard]] static constexpr std::size_t capacity() {
+        return Capacity;
+    }
+
+private:
+    alignas(64) std::atomic<std::size_t> writeIndex {0};
+    alignas(64) std::atomic<std::size_t> readIndex {0};
+
+private:
+    std::array<T, Capacity> values {};
+};
+
+}
@@ -0,0 +1,130 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "WorkStealingPool.hpp"
+
+#include <algorithm>
+
+namespace ds::concurrency {
+
+namespace {
+
+//! @brief The pool that the current thread works for, if any, and the index of its queue.
+
+thread_local WorkStealingPool const* currentPool = nullptr;
+thread_local std::size_t currentQueue = 0;
+
+}
+
+WorkStealingPool::WorkStealingPool(std::size_t const threadCount) {
+    auto const count = std::max<std::size_t>(1, threadCount);
+
+    queues.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+
+    threads.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        threads.emplace_back(&WorkStealingPool::run, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::scoped_lock lock(sleepMutex);
+        stopping = true;
+    }
+
+    wake.notify_all();
+
+    for (auto& thread: threads) {
+        thread.join();
+    }
+}
+
+std::size_t WorkStealingPool::getDefaultThreadCount() {
+    auto const hardwareThreads = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    return std::max<std::size_t>(1, hardwareThreads > 1 ? hardwareThreads - 1 : 1);
+}
+
+void WorkStealingPool::push(Job&& job) {
+    auto const index = currentPool == this ? currentQueue
+                                           : nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+
+    // Count the task before queueing it, so that a worker which takes it never sees the count fall below zero.
+
+    {
+        std::scoped_lock lock(sleepMutex);
+        ++queued;
+    }
+
+    {
+        std::scoped_lock lock(queues[index]->mutex);
+        queues[index]->jobs.push_back(std::move(job));
+    }
+
+    wake.notify_one();
+}
+
+bool WorkStealingPool::pop(std::size_t const index, Job& job) {
+    auto& queue = *queues[index];
+    std::scoped_lock lock(queue.mutex);
+
+    if (queue.jobs.empty()) {
+        return false;
+    }
+
+    job = std::move(queue.jobs.back());
+    queue.jobs.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::steal(std::size_t const index, Job& job) {
+    for (std::size_t offset = 1; offset < queues.size(); ++offset) {
+        auto& queue = *queues[(index + offset) % queues.size()];
+        std::scoped_lock lock(queue.mutex);
+
+        if (not queue.jobs.empty()) {
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            stolen.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void WorkStealingPool::run(std::size_t const index) {
+    currentPool = this;
+    currentQueue = index;
+
+    Job job;
+
+    while (true) {
+        if (pop(index, job) or steal(index, job)) {
+            {
+                std::scoped_lock lock(sleepMutex);
+                --queued;
+            }
+
+            job();
+            job = nullptr;
+            continue;
+        }
+
+        // Sleep until a task is queued, or until the pool stops and no tasks remain.
+
+        std::unique_lock lock(sleepMutex);
+        wake.wait(lock, [this] {
+            return queued > 0 or stopping;
+        });
+
+        if (stopping and queued == 0) {
+            return;
+        }
+    }
+}
+
+}
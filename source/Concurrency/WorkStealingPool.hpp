@@ -0,0 +1,103 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <condition_variable>
+
+namespace ds::concurrency {
+
+//! @class A fixed set of worker threads that run submitted tasks, stealing from each other when idle.
+//! @note Each worker owns a queue. A task submitted from a worker goes to the back of that worker's queue and
+//! the worker takes its own tasks from the back, while an idle worker steals from the front of another's queue.
+//! Tasks submitted from any other thread are spread across the queues in turn.
+
+class WorkStealingPool {
+public:
+    //! @brief Create a pool with the given number of worker threads.
+    //! @param threadCount The number of workers, which defaults to one fewer than the number of hardware threads.
+
+    explicit WorkStealingPool(std::size_t threadCount = getDefaultThreadCount());
+
+    //! @brief Finish every submitted task and join the worker threads.
+
+    ~WorkStealingPool();
+
+    WorkStealingPool(WorkStealingPool const&) = delete;
+    WorkStealingPool& operator=(WorkStealingPool const&) = delete;
+
+public:
+    //! @brief Run the given task on one of the pool's workers.
+    //! @param task A callable that takes no arguments.
+    //! @return A future that holds the task's result, or the exception that it threw.
+
+    template <typename Task>
+    auto submit(Task&& task) -> std::future<std::invoke_result_t<std::decay_t<Task>&>> {
+        using Result = std::invoke_result_t<std::decay_t<Task>&>;
+
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<Task>(task));
+        auto future = packaged->get_future();
+        push([packaged]() {
+            (*packaged)();
+        });
+
+        return future;
+    }
+
+public:
+    //! @brief Get the number of worker threads.
+
+    [[nodiscard]] inline std::size_t getThreadCount() const {
+        return threads.size();
+    }
+
+    //! @brief Get the number of tasks that workers have taken from another worker's queue.
+
+    [[nodiscard]] inline std::size_t getStolenTaskCount() const {
+        return stolen.load(std::memory_order_relaxed);
+    }
+
+    //! @brief Get the number of worker threads that suits the current machine.
+
+    [[nodiscard]] static std::size_t getDefaultThreadCount();
+
+private:
+    using Job = std::function<void()>;
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+private:
+    void push(Job&& job);
+    bool pop(std::size_t index, Job& job);
+    bool steal(std::size_t index, Job& job);
+    void run(std::size_t index);
+
+private:
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> threads;
+
+private:
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    std::size_t queued {0};
+    bool stopping {false};
+
+private:
+    std::atomic<std::size_t> nextQueue {0};
+    std::atomic<std::size_t> stolen {0};
+};
+
+}
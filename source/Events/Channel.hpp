@@ -0,0 +1,133 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <Events/Event.hpp>
+#include <Events/EventsDispatcher.hpp>
+
+namespace ds::events {
+
+//! @class The receivers of a given concrete type that are subscribed to the events of the given type.
+//! @note Receivers are stored by their concrete type and their handler is named with a qualified call, so delivering
+//! an event is statically bound: it requires neither a virtual call, nor a call through a function pointer, nor a
+//! downcast, and the handler can be inlined into the dispatch loop.
+
+template <typename EventType, typename Receiver>
+class ChannelSubscribers final {
+public:
+    ChannelSubscribers() = delete;
+
+public:
+    //! @brief Deliver the given event to each subscribed receiver.
+    //! @param event The event to be delivered.
+
+    static inline void dispatch(EventType const& event) {
+        for (auto* const receiver: receivers) {
+            receiver->Receiver::onEvent(event);
+        }
+    }
+
+    //! @brief Subscribe the given receiver.
+    //! @param receiver The receiver, whose `onEvent(EventType const&)` should receive events.
+
+    static void subscribe(Receiver* const receiver) {
+        receivers.push_back(receiver);
+    }
+
+    //! @brief Unsubscribe the given receiver.
+    //! @param receiver The receiver that should no longer receive events.
+
+    static void unsubscribe(Receiver* const receiver) {
+        auto iterator = std::find(receivers.cbegin(), receivers.cend(), receiver);
+        if (iterator != receivers.cend()) {
+            receivers.erase(iterator);
+        }
+    }
+
+    //! @brief Get the number of subscribed receivers.
+
+    [[nodiscard]] static inline std::size_t size() {
+        return receivers.size();
+    }
+
+private:
+    static std::vector<Receiver*> inline receivers {};
+};
+
+//! @class An event channel keyed by the type of its events and the concrete types of its receivers.
+//! @note The channel delivers each event to the subscribers of each of the given receiver types in turn, so each
+//! handler is statically bound. A receiver subscribes through `ChannelSubscribers<EventType, Receiver>`, most simply
+//! by inheriting from `ChannelReceiver`.
+
+template <typename EventType, typename... Receivers>
+class Channel final {
+public:
+    Channel() = delete;
+
+public:
+    //! @brief Deliver the given event to each subscribed receiver of each of the channel's receiver types.
+    //! @param event The event to be delivered.
+
+    static inline void dispatch(EventType const& event) {
+        (ChannelSubscribers<EventType, Receivers>::dispatch(event), ...);
+    }
+
+    //! @brief Get the number of subscribed receivers across each of the channel's receiver types.
+
+    [[nodiscard]] static inline std::size_t size() {
+        return (std::size_t {0} + ... + ChannelSubscribers<EventType, Receivers>::size());
+    }
+};
+
+//! @class A class that receives the events of the given type that are dispatched through a channel naming it.
+//! @note The derived class should implement `void onEvent(EventType const& event)`.
+
+template <typename Derived, typename EventType>
+class ChannelReceiver {
+public:
+    ChannelReceiver() {
+        ChannelSubscribers<EventType, Derived>::subscribe(static_cast<Derived*>(this));
+    }
+
+    ChannelReceiver(ChannelReceiver const&) = delete;
+    ChannelReceiver& operator=(ChannelReceiver const&) = delete;
+
+    ~ChannelReceiver() {
+        ChannelSubscribers<EventType, Derived>::unsubscribe(static_cast<Derived*>(this));
+    }
+};
+
+//! @class An adapter that forwards the events of a typed channel to the receivers of the given dispatcher.
+//! @note This allows `Receiver<EventId>` subclasses to receive events published through a `Channel` that names
+//! `ChannelAdapter<EventType, EventDispatcher>` among its receiver types.
+
+template <typename EventType, typename EventDispatcher = ds::events::Dispatcher>
+class ChannelAdapter final {
+public:
+    ChannelAdapter() {
+        static_assert(std::is_base_of_v<Event, EventType>,
+                      "The given event type must inherit from ds::events::Event.");
+
+        ChannelSubscribers<EventType, ChannelAdapter>::subscribe(this);
+    }
+
+    ChannelAdapter(ChannelAdapter const&) = delete;
+    ChannelAdapter& operator=(ChannelAdapter const&) = delete;
+
+    ~ChannelAdapter() {
+        ChannelSubscribers<EventType, ChannelAdapter>::unsubscribe(this);
+    }
+
+private:
+    friend class ChannelSubscribers<EventType, ChannelAdapter>;
+
+    void onEvent(EventType const& event) {
+        EventDispatcher::dispatch(event);
+    }
+};
+
+}
@@ -0,0 +1,169 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "ConcurrentDispatcher.hpp"
+
+#include <thread>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+
+namespace ds::events {
+
+std::array<ConcurrentDispatcher::Channel, ConcurrentDispatcher::MaximumChannels> ConcurrentDispatcher::channels {};
+std::atomic<std::uint32_t> ConcurrentDispatcher::epoch {0};
+std::array<std::atomic<std::uint32_t>, 2> ConcurrentDispatcher::dispatches {};
+thread_local int ConcurrentDispatcher::dispatchDepth {0};
+std::mutex ConcurrentDispatcher::writerMutex {};
+std::mutex ConcurrentDispatcher::reclaimMutex {};
+std::vector<ConcurrentDispatcher::EventReceivers const*> ConcurrentDispatcher::retired {};
+
+namespace {
+
+//! @brief Hold a dispatch open for the lifetime of the guard, so that a receiver which throws
+//! cannot leave a writer waiting for a dispatch that has already unwound.
+
+struct DispatchGuard {
+    DispatchGuard(std::atomic<std::uint32_t>& dispatches, int& depth): dispatches(dispatches), depth(depth) {
+        dispatches.fetch_add(1);
+        ++depth;
+    }
+
+    ~DispatchGuard() {
+        --depth;
+        dispatches.fetch_sub(1, std::memory_order_release);
+    }
+
+    DispatchGuard(DispatchGuard const&) = delete;
+    DispatchGuard& operator=(DispatchGuard const&) = delete;
+
+    std::atomic<std::uint32_t>& dispatches;
+    int& depth;
+};
+
+}
+
+void ConcurrentDispatcher::dispatch(Event const& event) {
+    auto const* channel = findChannel(event.id);
+    if (channel == nullptr) {
+        return;
+    }
+
+    auto const parity = epoch.load() & 1u;
+    auto const guard = DispatchGuard(dispatches[parity], dispatchDepth);
+
+    if (auto const* receivers = channel->receivers.load()) {
+        for (auto receiver: *receivers) {
+            receiver->onEvent(event);
+        }
+    }
+}
+
+void ConcurrentDispatcher::subscribe(int const eventId, ReceiverInterface* const receiver) {
+    update(eventId, receiver, true);
+}
+
+void ConcurrentDispatcher::unsubscribe(int const eventId, ReceiverInterface* const receiver) {
+    update(eventId, receiver, false);
+}
+
+void ConcurrentDispatcher::update(int const eventId, ReceiverInterface* const receiver, bool const shouldSubscribe) {
+    std::vector<EventReceivers const*> reclaimable;
+
+    {
+        std::scoped_lock lock(writerMutex);
+
+        auto* channel = shouldSubscribe ? findOrCreateChannel(eventId)
+                                        : const_cast<Channel*>(findChannel(eventId));
+        if (channel == nullptr) {
+            return;
+        }
+
+        auto const* current = channel->receivers.load(std::memory_order_acquire);
+        auto next = current != nullptr ? std::make_unique<EventReceivers>(*current)
+                                       : std::make_unique<EventReceivers>();
+
+        if (shouldSubscribe) {
+            next->push_back(receiver);
+        } else {
+            auto iterator = std::find(next->cbegin(), next->cend(), receiver);
+            if (iterator == next->cend()) {
+                return;
+            }
+
+            next->erase(iterator);
+        }
+
+        channel->receivers.store(next.release());
+
+        if (current != nullptr) {
+            retired.push_back(current);
+        }
+
+        // A dispatch in progress on this thread could never finish while we wait for it,
+        // so the retired snapshots are left for the next update made outside of a dispatch.
+        if (dispatchDepth > 0) {
+            return;
+        }
+
+        reclaimable.swap(retired);
+    }
+
+    std::scoped_lock lock(reclaimMutex);
+    waitForDispatches();
+
+    for (auto const* receivers: reclaimable) {
+        delete receivers;
+    }
+}
+
+ConcurrentDispatcher::Channel const* ConcurrentDispatcher::findChannel(int const eventId) {
+    auto const hash = static_cast<std::size_t>(static_cast<std::uint32_t>(eventId) * 2654435761u);
+
+    for (std::size_t probe = 0; probe < MaximumChannels; ++probe) {
+        auto const& channel = channels[(hash + probe) % MaximumChannels];
+
+        if (not channel.isOccupied.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+
+        if (channel.eventId == eventId) {
+            return &channel;
+        }
+    }
+
+    return nullptr;
+}
+
+ConcurrentDispatcher::Channel* ConcurrentDispatcher::findOrCreateChannel(int const eventId) {
+    auto const hash = static_cast<std::size_t>(static_cast<std::uint32_t>(eventId) * 2654435761u);
+
+    for (std::size_t probe = 0; probe < MaximumChannels; ++probe) {
+        auto& channel = channels[(hash + probe) % MaximumChannels];
+
+        if (not channel.isOccupied.load(std::memory_order_acquire)) {
+            channel.eventId = eventId;
+            channel.isOccupied.store(true, std::memory_order_release);
+            return &channel;
+        }
+
+        if (channel.eventId == eventId) {
+            return &channel;
+        }
+    }
+
+    throw std::length_error("The ConcurrentDispatcher cannot hold any more event channels.");
+}
+
+void ConcurrentDispatcher::waitForDispatches() {
+    // Two flips guarantee that a dispatch which read the epoch just before
+    // the first flip has also been waited on.
+    for (auto flip = 0; flip < 2; ++flip) {
+        auto const parity = epoch.fetch_add(1) & 1u;
+        while (dispatches[parity].load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+}
@@ -0,0 +1,82 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include <Events/Event.hpp>
+#include <Events/EventsReceiverInterface.hpp>
+
+namespace ds::events {
+
+//! @class A dispatcher whose dispatch path is lock-free and allocation-free.
+//! @note Each dispatch reads an immutable snapshot of its channel's receivers, so receivers may subscribe
+//! and unsubscribe on one thread while events are being dispatched on another. A replaced snapshot is
+//! reclaimed once every dispatch that could have observed it has finished.
+
+class ConcurrentDispatcher final {
+public:
+    ConcurrentDispatcher() = delete;
+
+public:
+    //! @brief Deliver the given event to each receiver subscribed to its channel.
+    //! @param event The event to be delivered.
+
+    static void dispatch(Event const& event);
+
+    //! @brief Subscribe the given receiver to the given event channel.
+    //! @param eventId The identifier of the desired event channel.
+    //! @param receiver The receiver to be subscribed.
+
+    static void subscribe(int eventId, ReceiverInterface* receiver);
+
+    //! @brief Unsubscribe the given receiver from the given event channel.
+    //! @note When invoked outside of a dispatch, this returns once no dispatch can deliver to the receiver.
+    //! @param eventId The identifier of the event channel.
+    //! @param receiver The receiver to be unsubscribed.
+
+    static void unsubscribe(int eventId, ReceiverInterface* receiver);
+
+public:
+    //! @brief The maximum number of distinct event channels.
+
+    static constexpr std::size_t MaximumChannels {64};
+
+private:
+    using EventReceivers = std::vector<ReceiverInterface*>;
+
+    struct Channel {
+        ~Channel() {
+            delete receivers.load();
+        }
+
+        int eventId {0};
+        std::atomic<bool> isOccupied {false};
+        std::atomic<EventReceivers const*> receivers {nullptr};
+    };
+
+private:
+    static void update(int eventId, ReceiverInterface* receiver, bool shouldSubscribe);
+    static Channel const* findChannel(int eventId);
+    static Channel* findOrCreateChannel(int eventId);
+    static void waitForDispatches();
+
+private:
+    static std::array<Channel, MaximumChannels> channels;
+
+private:
+    static std::atomic<std::uint32_t> epoch;
+    static std::array<std::atomic<std::uint32_t>, 2> dispatches;
+    static thread_local int dispatchDepth;
+
+private:
+    static std::mutex writerMutex;
+    static std::mutex reclaimMutex;
+    static std::vector<EventReceivers const*> retired;
+};
+
+}
@@ -8,6 +8,12 @@
 
 namespace ds::ui {
 
+//! @enum The kinds of action that a cursor event can represent.
+
+enum class CursorAction {
+    Move, Down, Drag, Up
+};
+
 //! @struct The state of a cursor event.
 
 struct CursorEventData {
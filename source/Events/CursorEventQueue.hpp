@@ -0,0 +1,146 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <UI/Point.hpp>
+#include <Events/CursorEvent.hpp>
+#include <Events/CursorTarget.hpp>
+#include <Events/EventsDispatcher.hpp>
+
+namespace ds::ui {
+
+//! @class A fixed-capacity queue of cursor events that is flushed once per frame.
+//! @note Consecutive move or drag events with the same button state are merged into the most recent event,
+//! while presses and releases are always delivered in the order in which they were received.
+
+template <std::size_t Capacity = 256>
+class CursorEventQueue {
+public:
+    //! @struct Counters describing the events that have passed through the queue.
+
+    struct Statistics {
+        std::size_t received {0};
+        std::size_t coalesced {0};
+        std::size_t delivered {0};
+        std::size_t dropped {0};
+    };
+
+public:
+    CursorEventQueue() = default;
+
+public:
+    //! @brief Add the given event to the queue, merging it with the previous event where possible.
+    //! @param action The action that the event represents.
+    //! @param event The state of the cursor.
+    //! @return Whether the event was queued, which is `false` only if the queue is full.
+
+    bool enqueue(CursorAction const action, CursorEventData const& event) {
+        ++stats.received;
+
+        if (count > 0) {
+            auto& previous = records[(head + count - 1) % Capacity];
+
+            if (isCoalescable(previous, action, event)) {
+                previous.xy = event.xy;
+                ++stats.coalesced;
+                return true;
+            }
+        }
+
+        if (count == Capacity) {
+            ++stats.dropped;
+            return false;
+        }
+
+        records[(head + count) % Capacity] = {action, event.xy, event.leftButtonIsPressed, event.rightButtonIsPressed};
+        ++count;
+
+        return true;
+    }
+
+    //! @brief Deliver each queued event in order and empty the queue.
+    //! @param receiver A callable accepting a `CursorAction` and a `CursorEvent const&`.
+
+    template <typename Receiver>
+    void flush(Receiver&& receiver) {
+        while (count > 0) {
+            auto const record = records[head];
+            head = (head + 1) % Capacity;
+            --count;
+
+            receiver(record.action, CursorEvent(record.xy, record.leftButtonIsPressed, record.rightButtonIsPressed));
+            ++stats.delivered;
+        }
+    }
+
+    //! @brief Deliver each queued event to the given cursor target in order and empty the queue.
+    //! @param target The cursor target that should receive the queued events.
+
+    void flush(CursorTarget& target) {
+        flush([&target](CursorAction const action, CursorEvent const& event) {
+            target.cursorAction(action, event);
+        });
+    }
+
+    //! @brief Deliver each queued event through the events dispatcher in order and empty the queue.
+
+    void flush() {
+        flush([](CursorAction, CursorEvent const& event) {
+            ds::events::Dispatcher::dispatch(event);
+        });
+    }
+
+public:
+    //! @brief Get the number of queued events.
+
+    [[nodiscard]] inline std::size_t size() const {
+        return count;
+    }
+
+    //! @brief Indicate whether the queue is empty or not.
+
+    [[nodiscard]] inline bool isEmpty() const {
+        return count == 0;
+    }
+
+    //! @brief Get the queue's counters.
+
+    [[nodiscard]] inline Statistics const& statistics() const {
+        return stats;
+    }
+
+    //! @brief Reset the queue's counters.
+
+    inline void resetStatistics() {
+        stats = {};
+    }
+
+private:
+    struct Record {
+        CursorAction action {CursorAction::Move};
+        Point<int> xy {};
+        bool leftButtonIsPressed {false};
+        bool rightButtonIsPressed {false};
+    };
+
+private:
+    static inline bool isCoalescable(Record const& previous, CursorAction const action, CursorEventData const& event) {
+        return (action == CursorAction::Move or action == CursorAction::Drag) and
+               previous.action == action and
+               previous.leftButtonIsPressed == event.leftButtonIsPressed and
+               previous.rightButtonIsPressed == event.rightButtonIsPressed;
+    }
+
+private:
+    std::array<Record, Capacity> records {};
+    std::size_t head {0};
+    std::size_t count {0};
+
+private:
+    Statistics stats {};
+};
+
+}
@@ -60,6 +60,19 @@ public:
         }
     }
 
+    //! @brief Invoke the method corresponding to the given cursor action.
+    //! @param action The action that the event represents.
+    //! @param event An event representing the state of the cursor.
+
+    inline void cursorAction(CursorAction const action, CursorEvent const& event) {
+        switch (action) {
+            case CursorAction::Move: return cursorMove(event);
+            case CursorAction::Down: return cursorDown(event);
+            case CursorAction::Drag: return cursorDrag(event);
+            case CursorAction::Up: return cursorUp(event);
+        }
+    }
+
 public:
     //! @brief Indicate whether the cursor is hovering over the target or not.
 
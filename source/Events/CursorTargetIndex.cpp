@@ -0,0 +1,232 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "CursorTargetIndex.hpp"
+
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+#include <Profiling/Profiler.hpp>
+
+namespace ds::ui {
+
+CursorTargetIndex::CursorTargetIndex(float const cellSize):
+        cellSize(std::max(1.0f, cellSize)) {
+}
+
+CursorTargetIndex::~CursorTargetIndex() {
+    for (auto const& [bounds, entryIndex]: boundsLookup) {
+        bounds->setObserver(nullptr);
+    }
+}
+
+void CursorTargetIndex::insert(CursorTarget& target, Bounds<float> const& bounds, float const padding) {
+    if (auto const indexed = boundsLookup.find(&bounds); indexed != boundsLookup.end()) {
+        if (entries[indexed->second].target != &target) {
+            throw std::logic_error("The bounds is already indexed for another cursor target.");
+        }
+    }
+
+    if (lookup.contains(&target)) {
+        remove(target);
+    }
+
+    bounds.setObserver(this);
+
+    std::size_t entryIndex;
+    if (freeEntries.empty()) {
+        entryIndex = entries.size();
+        entries.emplace_back();
+    } else {
+        entryIndex = freeEntries.back();
+        freeEntries.pop_back();
+    }
+
+    auto& entry = entries[entryIndex];
+    entry.target = &target;
+    entry.bounds = &bounds;
+    entry.padding = std::max(0.0f, padding);
+    entry.cells = getCellRange(entry);
+    entry.stamp = 0;
+
+    lookup[&target] = entryIndex;
+    boundsLookup[&bounds] = entryIndex;
+    addToCells(entryIndex);
+
+    if (target.isCursorHovering() or target.isBeingPressed()) {
+        active.push_back(entryIndex);
+    }
+}
+
+void CursorTargetIndex::remove(CursorTarget const& target) {
+    auto const iterator = lookup.find(&target);
+    if (iterator == lookup.end()) {
+        return;
+    }
+
+    auto const entryIndex = iterator->second;
+    auto const* bounds = entries[entryIndex].bounds;
+    bounds->setObserver(nullptr);
+    boundsLookup.erase(bounds);
+
+    if (entries[entryIndex].isStale) {
+        std::erase(staleEntries, entryIndex);
+    }
+
+    removeFromCells(entryIndex);
+    std::erase(active, entryIndex);
+
+    entries[entryIndex] = {};
+    freeEntries.push_back(entryIndex);
+    lookup.erase(iterator);
+}
+
+void CursorTargetIndex::update(CursorTarget const& target) {
+    auto const iterator = lookup.find(&target);
+    if (iterator == lookup.end()) {
+        return;
+    }
+
+    updateCells(iterator->second);
+}
+
+void CursorTargetIndex::refresh() {
+    for (auto const entryIndex: staleEntries) {
+        entries[entryIndex].isStale = false;
+        updateCells(entryIndex);
+    }
+
+    staleEntries.clear();
+}
+
+void CursorTargetIndex::route(CursorAction const action, CursorEvent const& event) {
+    DS_PROFILE_SCOPE("CursorTargetIndex", Event);
+
+    if (not staleEntries.empty()) {
+        refresh();
+    }
+
+    ++stamp;
+    delivered.clear();
+
+    // Targets that are hovered over or pressed are delivered to first,
+    // so that a target is left before its neighbour is entered.
+    for (auto const entryIndex: active) {
+        deliver(entryIndex, action, event);
+    }
+
+    auto const key = getCellKey(getCellCoordinate(static_cast<float>(event.xy.x)),
+                                getCellCoordinate(static_cast<float>(event.xy.y)));
+
+    if (auto const cell = cells.find(key); cell != cells.end()) {
+        auto const x = static_cast<float>(event.xy.x);
+        auto const y = static_cast<float>(event.xy.y);
+
+        for (auto const entryIndex: cell->second) {
+            auto const& entry = entries[entryIndex];
+            auto const& origin = entry.bounds->origin();
+            auto const& size = entry.bounds->size();
+
+            if (x >= origin.x - entry.padding and x <= origin.x + size.w + entry.padding and
+                y >= origin.y - entry.padding and y <= origin.y + size.h + entry.padding) {
+                deliver(entryIndex, action, event);
+            }
+        }
+    }
+
+    active.clear();
+    for (auto const entryIndex: delivered) {
+        auto const* target = entries[entryIndex].target;
+        if (target->isCursorHovering() or target->isBeingPressed()) {
+            active.push_back(entryIndex);
+        }
+    }
+}
+
+void CursorTargetIndex::boundsDidChange(Bounds<float> const& bounds) {
+    auto const indexed = boundsLookup.find(&bounds);
+    if (indexed == boundsLookup.end()) {
+        return;
+    }
+
+    // A bounds may change several times before the next event, but its entry is re-indexed only once.
+
+    auto& entry = entries[indexed->second];
+    if (not entry.isStale) {
+        entry.isStale = true;
+        staleEntries.push_back(indexed->second);
+    }
+}
+
+CursorTargetIndex::CellRange CursorTargetIndex::getCellRange(Entry const& entry) const {
+    auto const& origin = entry.bounds->origin();
+    auto const& size = entry.bounds->size();
+
+    return {
+            getCellCoordinate(origin.x - entry.padding),
+            getCellCoordinate(origin.y - entry.padding),
+            getCellCoordinate(origin.x + size.w + entry.padding),
+            getCellCoordinate(origin.y + size.h + entry.padding)
+    };
+}
+
+int CursorTargetIndex::getCellCoordinate(float const coordinate) const {
+    return static_cast<int>(std::floor(coordinate / cellSize));
+}
+
+void CursorTargetIndex::updateCells(std::size_t const entryIndex) {
+    auto const cellRange = getCellRange(entries[entryIndex]);
+
+    if (cellRange != entries[entryIndex].cells) {
+        removeFromCells(entryIndex);
+        entries[entryIndex].cells = cellRange;
+        addToCells(entryIndex);
+    }
+}
+
+void CursorTargetIndex::addToCells(std::size_t const entryIndex) {
+    auto const& range = entries[entryIndex].cells;
+
+    for (auto y = range.y0; y <= range.y1; ++y) {
+        for (auto x = range.x0; x <= range.x1; ++x) {
+            cells[getCellKey(x, y)].push_back(entryIndex);
+        }
+    }
+}
+
+void CursorTargetIndex::removeFromCells(std::size_t const entryIndex) {
+    auto const& range = entries[entryIndex].cells;
+
+    for (auto y = range.y0; y <= range.y1; ++y) {
+        for (auto x = range.x0; x <= range.x1; ++x) {
+            auto const cell = cells.find(getCellKey(x, y));
+            if (cell == cells.end()) {
+                continue;
+            }
+
+            auto& members = cell->second;
+            auto const member = std::find(members.begin(), members.end(), entryIndex);
+            if (member != members.end()) {
+                *member = members.back();
+                members.pop_back();
+            }
+
+            if (members.empty()) {
+                cells.erase(cell);
+            }
+        }
+    }
+}
+
+void CursorTargetIndex::deliver(std::size_t const entryIndex, CursorAction const action, CursorEvent const& event) {
+    auto& entry = entries[entryIndex];
+    if (entry.stamp == stamp) {
+        return;
+    }
+
+    entry.stamp = stamp;
+    entry.target->cursorAction(action, event);
+    delivered.push_back(entryIndex);
+}
+
+}
@@ -0,0 +1,141 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include <UI/Bounds.hpp>
+#include <Events/CursorEvent.hpp>
+#include <Events/CursorTarget.hpp>
+
+namespace ds::ui {
+
+//! @class A uniform-grid spatial index that routes each cursor event to the cursor targets that could contain it.
+//! @note A target that is hovered over or pressed continues to receive events until it is neither, so the
+//! enter and leave transitions of `CursorTarget::cursorMove` are preserved. Targets far from the cursor that are
+//! neither hovered over nor pressed do not receive `cursorWasDown` or `cursorWasUp`. The index observes the
+//! bounds of its targets and records those that are moved or resized, so only they are re-indexed before the next
+//! event is routed.
+
+class CursorTargetIndex: private BoundsObserver<float> {
+public:
+    //! @brief Create an empty index.
+    //! @param cellSize The size of the index's square cells in pixels.
+
+    explicit CursorTargetIndex(float cellSize = 64.0f);
+
+    CursorTargetIndex(CursorTargetIndex const&) = delete;
+    CursorTargetIndex& operator=(CursorTargetIndex const&) = delete;
+
+    ~CursorTargetIndex() override;
+
+public:
+    //! @brief Add the given target to the index.
+    //! @param target The cursor target to be added.
+    //! @param bounds The bounds of the target, which must outlive the target's membership of the index.
+    //! The index becomes the bounds' observer, so the bounds must not be observed by another object or be indexed
+    //! for another target, or a `std::logic_error` is thrown.
+    //! @param padding An amount by which the target's bounds should be expanded on each side.
+
+    void insert(CursorTarget& target, Bounds<float> const& bounds, float padding = 0.0f);
+
+    //! @brief Add the given component, which should be both a cursor target and a bounds, to the index.
+    //! @param component The component to be added.
+    //! @param padding An amount by which the component's bounds should be expanded on each side.
+
+    template <typename ComponentType>
+    inline void insert(ComponentType& component, float const padding = 0.0f) {
+        insert(static_cast<CursorTarget&>(component), static_cast<Bounds<float> const&>(component), padding);
+    }
+
+    //! @brief Remove the given target from the index.
+    //! @param target The cursor target to be removed.
+
+    void remove(CursorTarget const& target);
+
+    //! @brief Update the index after the bounds of the given target have changed.
+    //! @note This is done on demand when the next event is routed, so it need only be called to do it sooner.
+    //! @param target The cursor target whose bounds have changed.
+
+    void update(CursorTarget const& target);
+
+    //! @brief Update the index for each target whose bounds have changed since the last update.
+    //! @note This is done on demand when the next event is routed, so it need only be called to do it sooner.
+
+    void refresh();
+
+public:
+    //! @brief Deliver the given cursor event to the targets that could be affected by it.
+    //! @param action The action that the event represents.
+    //! @param event An event representing the state of the cursor.
+
+    void route(CursorAction action, CursorEvent const& event);
+
+public:
+    //! @brief Get the number of targets in the index.
+
+    [[nodiscard]] inline std::size_t size() const {
+        return lookup.size();
+    }
+
+    //! @brief Get the number of targets whose bounds have changed and that are yet to be re-indexed.
+
+    [[nodiscard]] inline std::size_t pendingUpdateCount() const {
+        return staleEntries.size();
+    }
+
+    //! @brief Get the number of targets that received the most recently routed event.
+
+    [[nodiscard]] inline std::size_t lastDeliveryCount() const {
+        return delivered.size();
+    }
+
+private:
+    struct CellRange {
+        int x0, y0, x1, y1;
+
+        bool operator==(CellRange const& other) const = default;
+    };
+
+    struct Entry {
+        CursorTarget* target {nullptr};
+        Bounds<float> const* bounds {nullptr};
+        float padding {0.0f};
+        CellRange cells {};
+        std::uint64_t stamp {0};
+        bool isStale {false};
+    };
+
+private:
+    void boundsDidChange(Bounds<float> const& bounds) override;
+
+private:
+    [[nodiscard]] CellRange getCellRange(Entry const& entry) const;
+    [[nodiscard]] int getCellCoordinate(float coordinate) const;
+    void updateCells(std::size_t entryIndex);
+    void addToCells(std::size_t entryIndex);
+    void removeFromCells(std::size_t entryIndex);
+    void deliver(std::size_t entryIndex, CursorAction action, CursorEvent const& event);
+
+    static inline std::uint64_t getCellKey(int const x, int const y) {
+        return static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32u | static_cast<std::uint32_t>(y);
+    }
+
+private:
+    float cellSize;
+    std::uint64_t stamp {0};
+
+private:
+    std::vector<Entry> entries;
+    std::vector<std::size_t> freeEntries;
+    std::vector<std::size_t> active;
+    std::vector<std::size_t> delivered;
+    std::vector<std::size_t> staleEntries;
+    std::unordered_map<CursorTarget const*, std::size_t> lookup;
+    std::unordered_map<Bounds<float> const*, std::size_t> boundsLookup;
+    std::unordered_map<std::uint64_t, std::vector<std::size_t>> cells;
+};
+
+}
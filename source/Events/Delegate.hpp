@@ -0,0 +1,226 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <functional>
+#include <type_traits>
+
+namespace ds::events {
+
+template <typename Signature>
+class FunctionRef;
+
+//! @class A non-owning reference to a callable object, which must outlive the reference.
+//! @note A reference is two pointers wide, so it can be passed by value, and it never allocates.
+
+template <typename Result, typename... Arguments>
+class FunctionRef<Result(Arguments...)> {
+public:
+    FunctionRef() = default;
+
+    FunctionRef(std::nullptr_t) noexcept {
+    }
+
+    //! @brief Create a reference to the given callable object.
+    //! @param callable The object to be referenced.
+
+    template <typename Callable, typename = std::enable_if_t<
+            not std::is_same_v<std::remove_cvref_t<Callable>, FunctionRef> and
+            std::is_invocable_r_v<Result, Callable&, Arguments...>>>
+    FunctionRef(Callable&& callable) noexcept:
+            object(const_cast<void*>(static_cast<void const*>(std::addressof(callable)))),
+            thunk(&invoke<std::remove_reference_t<Callable>>) {
+    }
+
+public:
+    //! @brief Invoke the referenced object with the given arguments.
+    //! @note The reference must not be empty.
+
+    inline Result operator()(Arguments... arguments) const {
+        return thunk(object, std::forward<Arguments>(arguments)...);
+    }
+
+    //! @brief Indicate whether the reference refers to a callable object.
+
+    explicit operator bool() const noexcept {
+        return thunk != nullptr;
+    }
+
+private:
+    template <typename Callable>
+    static Result invoke(void* const callable, Arguments... arguments) {
+        return std::invoke(*static_cast<Callable*>(callable), std::forward<Arguments>(arguments)...);
+    }
+
+private:
+    void* object {nullptr};
+    Result (* thunk)(void*, Arguments...) {nullptr};
+};
+
+//! @brief The default inline capacity of an `InlineFunction`, which holds a `std::function` with each of the
+//! major standard libraries (32 bytes with libstdc++, 48 with libc++ and 64 with MSVC's on 64-bit targets).
+
+inline constexpr std::size_t DefaultInlineCapacity = 8 * sizeof(void*);
+
+static_assert(sizeof(std::function<void()>) <= DefaultInlineCapacity,
+              "A std::function must fit the default inline storage");
+
+template <typename Signature, std::size_t Capacity = DefaultInlineCapacity>
+class InlineFunction;
+
+//! @class An owning wrapper of a callable object that stores the object inline rather than on the heap.
+//! @note A callable object that does not fit the given capacity, or that could throw as it is moved, is rejected
+//! at compile time, so wrapping a callable never allocates.
+
+template <typename Result, typename... Arguments, std::size_t Capacity>
+class InlineFunction<Result(Arguments...), Capacity> {
+public:
+    InlineFunction() = default;
+
+    InlineFunction(std::nullptr_t) noexcept {
+    }
+
+    //! @brief Create a function that stores a copy of the given callable object.
+    //! @param callable The object to be stored.
+
+    template <typename Callable, typename Stored = std::decay_t<Callable>, typename = std::enable_if_t<
+            not std::is_same_v<Stored, InlineFunction> and
+            std::is_invocable_r_v<Result, Stored&, Arguments...>>>
+    InlineFunction(Callable&& callable) {
+        static_assert(sizeof(Stored) <= Capacity,
+                      "The callable object must fit the function's inline storage");
+        static_assert(alignof(Stored) <= alignof(std::max_align_t),
+                      "The callable object must not be over-aligned");
+        static_assert(std::is_nothrow_move_constructible_v<Stored>,
+                      "The callable object must be nothrow move-constructible");
+        static_assert(std::is_copy_constructible_v<Stored>,
+                      "The callable object must be copy-constructible");
+
+        ::new(static_cast<void*>(&storage)) Stored(std::forward<Callable>(callable));
+        operations = &OperationsFor<Stored>::table;
+    }
+
+    InlineFunction(InlineFunction const& other) {
+        if (other.operations) {
+            other.operations->copy(&storage, &other.storage);
+            operations = other.operations;
+        }
+    }
+
+    InlineFunction(InlineFunction&& other) noexcept {
+        if (other.operations) {
+            other.operations->move(&storage, &other.storage);
+            operations = other.operations;
+        }
+    }
+
+    InlineFunction& operator=(InlineFunction const& other) {
+        if (this != &other) {
+            reset();
+            if (other.operations) {
+                other.operations->copy(&storage, &other.storage);
+                operations = other.operations;
+            }
+        }
+
+        return *this;
+    }
+
+    InlineFunction& operator=(InlineFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            if (other.operations) {
+                other.operations->move(&storage, &other.storage);
+                operations = other.operations;
+            }
+        }
+
+        return *this;
+    }
+
+    InlineFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    ~InlineFunction() {
+        reset();
+    }
+
+public:
+    //! @brief Invoke the stored object with the given arguments.
+    //! @note The function must not be empty.
+
+    inline Result operator()(Arguments... arguments) const {
+        return operations->invoke(const_cast<Storage*>(&storage), std::forward<Arguments>(arguments)...);
+    }
+
+    //! @brief Indicate whether the function stores a callable object.
+
+    explicit operator bool() const noexcept {
+        return operations != nullptr;
+    }
+
+private:
+    struct Storage {
+        alignas(std::max_align_t) std::byte bytes[Capacity];
+    };
+
+    struct Operations {
+        Result (* invoke)(void*, Arguments...);
+        void (* copy)(void*, void const*);
+        void (* move)(void*, void*) noexcept;
+        void (* destroy)(void*) noexcept;
+    };
+
+    template <typename Callable>
+    struct OperationsFor {
+        static Result invoke(void* const callable, Arguments... arguments) {
+            return std::invoke(*static_cast<Callable*>(callable), std::forward<Arguments>(arguments)...);
+        }
+
+        static void copy(void* const target, void const* const source) {
+            ::new(target) Callable(*static_cast<Callable const*>(source));
+        }
+
+        static void move(void* const target, void* const source) noexcept {
+            ::new(target) Callable(std::move(*static_cast<Callable*>(source)));
+        }
+
+        static void destroy(void* const callable) noexcept {
+            static_cast<Callable*>(callable)->~Callable();
+        }
+
+        static constexpr Operations table {&invoke, &copy, &move, &destroy};
+    };
+
+private:
+    inline void reset() noexcept {
+        if (operations) {
+            operations->destroy(&storage);
+            operations = nullptr;
+        }
+    }
+
+private:
+    Storage storage;
+    Operations const* operations {nullptr};
+};
+
+//! @brief Indicate whether the given callback can be invoked.
+//! @note A callback whose type cannot be empty, such as a lambda, can always be invoked.
+
+template <typename Callback>
+[[nodiscard]] inline bool isCallable(Callback const& callback) {
+    if constexpr (std::is_constructible_v<bool, Callback const&>) {
+        return static_cast<bool>(callback);
+    } else {
+        return true;
+    }
+}
+
+}
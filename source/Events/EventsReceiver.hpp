@@ -5,21 +5,23 @@
 
 #include <Events/Event.hpp>
 #include <Events/EventsDispatcher.hpp>
+#include <Events/ConcurrentDispatcher.hpp>
 #include <Events/EventsReceiverInterface.hpp>
 
 namespace ds::events {
 
 //! @class An abstract class that can receive events of the given event type.
+//! @tparam EventDispatcher The dispatcher whose events should be received, such as `Dispatcher` or `ConcurrentDispatcher`.
 
-template <int EventId>
+template <int EventId, typename EventDispatcher = ds::events::Dispatcher>
 class Receiver: public ReceiverInterface {
 public:
     Receiver() {
-        ds::events::Dispatcher::subscribe(EventId, this);
+        EventDispatcher::subscribe(EventId, this);
     }
 
     ~Receiver() override {
-        ds::events::Dispatcher::unsubscribe(EventId, this);
+        EventDispatcher::unsubscribe(EventId, this);
     }
 
 public:
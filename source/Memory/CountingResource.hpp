@@ -0,0 +1,86 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace ds::memory {
+
+//! @class A memory resource that counts the allocations it forwards to an upstream resource.
+//! @note Wrapping a resource in a counter makes allocations observable, so tests can verify that code which
+//! should not allocate does not.
+
+class CountingResource final: public std::pmr::memory_resource {
+public:
+    //! @brief Create a counter that forwards allocations to the given resource.
+    //! @param upstream The resource that allocates memory, which must outlive the counter.
+
+    explicit CountingResource(std::pmr::memory_resource* const upstream = std::pmr::new_delete_resource()):
+            upstream(upstream) {
+    }
+
+public:
+    //! @brief Get the number of allocations since the counts were last reset.
+
+    [[nodiscard]] inline std::size_t getAllocationCount() const {
+        return allocations;
+    }
+
+    //! @brief Get the number of deallocations since the counts were last reset.
+
+    [[nodiscard]] inline std::size_t getDeallocationCount() const {
+        return deallocations;
+    }
+
+    //! @brief Get the number of bytes allocated since the counts were last reset.
+
+    [[nodiscard]] inline std::size_t getBytesAllocated() const {
+        return bytesAllocated;
+    }
+
+    //! @brief Get the number of bytes that have been allocated and not yet deallocated.
+
+    [[nodiscard]] inline std::size_t getBytesInUse() const {
+        return bytesInUse;
+    }
+
+    //! @brief Reset the allocation, deallocation and byte counts, leaving the number of bytes in use as it is.
+
+    inline void resetCounts() {
+        allocations = 0;
+        deallocations = 0;
+        bytesAllocated = 0;
+    }
+
+private:
+    void* do_allocate(std::size_t const bytes, std::size_t const alignment) override {
+        auto* const memory = upstream->allocate(bytes, alignment);
+        ++allocations;
+        bytesAllocated = bytesAllocated + bytes;
+        bytesInUse = bytesInUse + bytes;
+        return memory;
+    }
+
+    void do_deallocate(void* const memory, std::size_t const bytes, std::size_t const alignment) override {
+        upstream->deallocate(memory, bytes, alignment);
+        ++deallocations;
+        bytesInUse = bytesInUse - bytes;
+    }
+
+    [[nodiscard]] bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    std::pmr::memory_resource* upstream;
+
+private:
+    std::size_t allocations {0};
+    std::size_t deallocations {0};
+    std::size_t bytesAllocated {0};
+    std::size_t bytesInUse {0};
+};
+
+}
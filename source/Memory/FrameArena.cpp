@@ -0,0 +1,80 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "FrameArena.hpp"
+
+#include <bit>
+#include <algorithm>
+
+namespace ds::memory {
+
+FrameArena::FrameArena(std::size_t const capacity, std::pmr::memory_resource* const upstream):
+        upstream(upstream),
+        overflow(upstream) {
+    allocateBlock(std::max<std::size_t>(capacity, alignof(std::max_align_t)));
+}
+
+FrameArena::~FrameArena() {
+    arena.reset();
+    releaseBlock();
+}
+
+FrameArena& FrameArena::get() {
+    static FrameArena frameArena;
+    return frameArena;
+}
+
+void FrameArena::endFrame() {
+    get().reset();
+}
+
+void FrameArena::reset() {
+    auto const didOverflow = hasOverflowed();
+
+    arena->release();
+    peakBytes = std::max(peakBytes, bytesAllocated);
+
+    // Enlarge the block so that a frame like this one fits with room for alignment padding.
+
+    if (didOverflow) {
+        auto const size = std::max(2 * capacity, std::bit_ceil(bytesAllocated) * 2);
+        arena.reset();
+        releaseBlock();
+        allocateBlock(size);
+    }
+
+    overflow.resetCounts();
+    bytesAllocated = 0;
+    allocations = 0;
+}
+
+void* FrameArena::do_allocate(std::size_t const bytes, std::size_t const alignment) {
+    auto* const memory = arena->allocate(bytes, alignment);
+    bytesAllocated = bytesAllocated + bytes;
+    ++allocations;
+    return memory;
+}
+
+void FrameArena::do_deallocate(void*, std::size_t, std::size_t) {
+    /* Memory is released when the arena is reset */
+}
+
+bool FrameArena::do_is_equal(std::pmr::memory_resource const& other) const noexcept {
+    return this == &other;
+}
+
+void FrameArena::allocateBlock(std::size_t const size) {
+    block = upstream->allocate(size, alignof(std::max_align_t));
+    capacity = size;
+    arena.emplace(block, capacity, &overflow);
+}
+
+void FrameArena::releaseBlock() {
+    if (block != nullptr) {
+        upstream->deallocate(block, capacity, alignof(std::max_align_t));
+        block = nullptr;
+        capacity = 0;
+    }
+}
+
+}
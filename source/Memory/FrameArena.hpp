@@ -0,0 +1,110 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <memory_resource>
+#include <Memory/CountingResource.hpp>
+
+namespace ds::memory {
+
+//! @class A monotonic arena for scratch memory that only needs to live until the end of the current frame.
+//! @note Memory is handed out by bumping a pointer through a single block and is never freed individually.
+//! Instead, `reset` releases everything at once at the end of each frame. If a frame outgrows the block, the
+//! overflow is taken from the upstream resource and the block is enlarged at the next reset, so a steady
+//! workload stops allocating from the upstream resource after its first frame. The arena is not thread-safe.
+
+class FrameArena final: public std::pmr::memory_resource {
+public:
+    static constexpr std::size_t DefaultCapacity = 64 * 1024;
+
+public:
+    //! @brief Create an arena with a block of the given capacity.
+    //! @param capacity The initial size of the arena's block in bytes.
+    //! @param upstream The resource that the block and any overflow are allocated from, which must outlive the arena.
+
+    explicit FrameArena(std::size_t capacity = DefaultCapacity,
+                        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+    ~FrameArena() override;
+
+    FrameArena(FrameArena const&) = delete;
+    FrameArena& operator=(FrameArena const&) = delete;
+
+    //! @brief Get the process-wide arena for scratch memory on the UI thread.
+    //! @note The application must call `endFrame` once per frame, after the frame has been drawn, or the memory
+    //! taken from the arena is never reclaimed. The library's components do not draw from this arena, since they
+    //! cannot rely on the application to do so.
+
+    static FrameArena& get();
+
+    //! @brief Mark the end of a frame on the UI thread, releasing the scratch memory of the process-wide arena.
+    //! @note Call this where the frame ends, alongside `DS_PROFILE_FRAME_END`, once nothing drawn during the frame
+    //! still refers to its scratch memory.
+
+    static void endFrame();
+
+public:
+    //! @brief Release all of the memory allocated during the frame, enlarging the block if the frame outgrew it.
+    //! @note Nothing allocated from the arena may be used after it is reset.
+
+    void reset();
+
+public:
+    //! @brief Get the size of the arena's block in bytes.
+
+    [[nodiscard]] inline std::size_t getCapacity() const {
+        return capacity;
+    }
+
+    //! @brief Get the number of bytes requested since the arena was last reset.
+
+    [[nodiscard]] inline std::size_t getBytesAllocated() const {
+        return bytesAllocated;
+    }
+
+    //! @brief Get the number of allocations since the arena was last reset.
+
+    [[nodiscard]] inline std::size_t getAllocationCount() const {
+        return allocations;
+    }
+
+    //! @brief Get the greatest number of bytes requested during any frame.
+
+    [[nodiscard]] inline std::size_t getPeakBytes() const {
+        return peakBytes;
+    }
+
+    //! @brief Indicate whether the current frame has outgrown the arena's block.
+
+    [[nodiscard]] inline bool hasOverflowed() const {
+        return overflow.getAllocationCount() > 0;
+    }
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* memory, std::size_t bytes, std::size_t alignment) override;
+    [[nodiscard]] bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override;
+
+private:
+    void allocateBlock(std::size_t size);
+    void releaseBlock();
+
+private:
+    std::pmr::memory_resource* upstream;
+    CountingResource overflow;
+
+private:
+    void* block {nullptr};
+    std::size_t capacity {0};
+    std::optional<std::pmr::monotonic_buffer_resource> arena;
+
+private:
+    std::size_t bytesAllocated {0};
+    std::size_t allocations {0};
+    std::size_t peakBytes {0};
+};
+
+}
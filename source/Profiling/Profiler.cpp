@@ -0,0 +1,153 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "Profiler.hpp"
+
+#include <map>
+#include <utility>
+#include <algorithm>
+#include <string_view>
+
+namespace ds::profiling {
+
+namespace {
+
+char const* getPhaseName(Phase const phase) {
+    switch (phase) {
+        case Phase::Draw: return "draw";
+        case Phase::Rebuild: return "rebuild";
+        case Phase::Event: return "event";
+    }
+
+    return "unknown";
+}
+
+void writeEscaped(std::ostream& stream, std::string_view const text) {
+    for (auto const character: text) {
+        if (character == '"' or character == '\\') {
+            stream << '\\';
+        }
+
+        stream << character;
+    }
+}
+
+//! @brief Write a time in nanoseconds as the microseconds that Chrome traces expect.
+
+void writeMicroseconds(std::ostream& stream, std::int64_t const nanoseconds) {
+    stream << nanoseconds / 1000 << '.';
+
+    auto const fraction = nanoseconds % 1000;
+    stream << (fraction < 100 ? "0" : "") << (fraction < 10 ? "0" : "") << fraction;
+}
+
+}
+
+Profiler::Profiler():
+        epoch(Clock::now()),
+        samples(std::make_unique<concurrency::SpscRing<Sample, SampleCapacity>>()),
+        frames(std::make_unique<concurrency::SpscRing<FrameRecord, FrameCapacity>>()) {
+}
+
+Profiler& Profiler::get() {
+    static Profiler profiler;
+    return profiler;
+}
+
+void Profiler::beginFrame() {
+    frameStart = now();
+}
+
+void Profiler::endFrame() {
+    auto frame = FrameRecord {currentFrame, frameStart, now() - frameStart};
+    for (std::size_t i = 0; i < creations.size(); ++i) {
+        frame.creations[i] = creations[i].exchange(0, std::memory_order_relaxed);
+    }
+
+    frames->push(frame);
+    currentFrame = currentFrame + 1;
+}
+
+void Profiler::collect() {
+    auto sample = Sample {};
+    while (samples->pop(sample)) {
+        sampleHistory.push_back(sample);
+    }
+
+    auto frame = FrameRecord {};
+    while (frames->pop(frame)) {
+        frameHistory.push_back(frame);
+    }
+}
+
+void Profiler::clear() {
+    collect();
+    sampleHistory.clear();
+    frameHistory.clear();
+    droppedSamples.store(0, std::memory_order_relaxed);
+}
+
+std::vector<Summary> Profiler::summarise() const {
+    // Names are usually string literals, but equal names in different translation units may have different
+    // addresses, so they are compared by content.
+    std::map<std::pair<std::string_view, Phase>, Summary> summaries;
+
+    for (auto const& sample: sampleHistory) {
+        auto& summary = summaries[{sample.name, sample.phase}];
+        summary.name = sample.name;
+        summary.phase = sample.phase;
+        summary.count = summary.count + 1;
+        summary.total = summary.total + sample.duration;
+        summary.maximum = std::max(summary.maximum, sample.duration);
+    }
+
+    auto result = std::vector<Summary>();
+    result.reserve(summaries.size());
+
+    for (auto const& [key, summary]: summaries) {
+        result.push_back(summary);
+    }
+
+    std::stable_sort(result.begin(), result.end(), [](Summary const& a, Summary const& b) {
+        return a.total > b.total;
+    });
+
+    return result;
+}
+
+void Profiler::writeChromeTrace(std::ostream& stream) const {
+    stream << R"({"displayTimeUnit":"ns","traceEvents":[)";
+
+    auto separator = "";
+    for (auto const& frame: frameHistory) {
+        stream << separator << R"({"name":"Frame","cat":"frame","ph":"X","pid":0,"tid":0,"ts":)";
+        writeMicroseconds(stream, frame.start);
+        stream << R"(,"dur":)";
+        writeMicroseconds(stream, frame.duration);
+        stream << R"(,"args":{"frame":)" << frame.frame << "}}";
+
+        stream << R"(,{"name":"GL objects created","ph":"C","pid":0,"tid":0,"ts":)";
+        writeMicroseconds(stream, frame.start);
+        stream << R"(,"args":{"batches":)" << frame.creations[0]
+               << R"(,"textures":)" << frame.creations[1]
+               << R"(,"programs":)" << frame.creations[2] << "}}";
+
+        separator = ",";
+    }
+
+    for (auto const& sample: sampleHistory) {
+        stream << separator << R"({"name":")";
+        writeEscaped(stream, sample.name);
+        stream << R"(","cat":")" << getPhaseName(sample.phase) << R"(","ph":"X","pid":0,"tid":0,"ts":)";
+        writeMicroseconds(stream, sample.start);
+        stream << R"(,"dur":)";
+        writeMicroseconds(stream, sample.duration);
+        stream << R"(,"args":{"frame":)" << sample.frame << "}}";
+
+        separator = ",";
+    }
+
+    stream << "]}";
+}
+
+}
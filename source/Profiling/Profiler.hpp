@@ -0,0 +1,216 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <Concurrency/SpscRing.hpp>
+
+namespace ds::profiling {
+
+//! @enum The kinds of work that a sample can measure.
+
+enum class Phase: std::uint8_t {
+    Draw, Rebuild, Event
+};
+
+//! @enum The kinds of graphics object whose creations are counted per frame.
+
+enum class Resource: std::uint8_t {
+    Batch, Texture, Program
+};
+
+//! @struct A timed span of work done by one type of component.
+//! @note The name must be a string literal, or otherwise outlive the profiler, because only its address is stored.
+//! Times are in nanoseconds since the profiler was created.
+
+struct Sample {
+    char const* name {nullptr};
+    Phase phase {Phase::Draw};
+    std::uint32_t frame {0};
+    std::int64_t start {0};
+    std::int64_t duration {0};
+};
+
+//! @struct The span of one frame and the number of graphics objects of each kind created during it.
+
+struct FrameRecord {
+    std::uint32_t frame {0};
+    std::int64_t start {0};
+    std::int64_t duration {0};
+    std::array<std::uint32_t, 3> creations {};
+};
+
+//! @struct The total and worst-case time spent on one phase of work by one type of component.
+
+struct Summary {
+    char const* name {nullptr};
+    Phase phase {Phase::Draw};
+    std::size_t count {0};
+    std::int64_t total {0};
+    std::int64_t maximum {0};
+};
+
+//! @class A recorder of per-component timings and graphics object creations.
+//! @note Samples and frames are written into lock-free rings by the UI thread, which never blocks or allocates, and
+//! are moved into the profiler's history by `collect`, which may be called from another thread. Samples that arrive
+//! while the ring is full are dropped and counted.
+
+class Profiler {
+public:
+    static constexpr std::size_t SampleCapacity = 16384;
+    static constexpr std::size_t FrameCapacity = 256;
+
+public:
+    //! @brief Create a profiler whose clock starts now.
+
+    Profiler();
+
+    //! @brief Get the process-wide profiler used by the `DS_PROFILE_*` macros.
+
+    static Profiler& get();
+
+public:
+    //! @brief Mark the start of a frame.
+
+    void beginFrame();
+
+    //! @brief Mark the end of the current frame and record its span and graphics object creations.
+
+    void endFrame();
+
+    //! @brief Record a timed span of work in the current frame.
+    //! @param name The name of the component type, which must outlive the profiler.
+    //! @param phase The kind of work.
+    //! @param start The start of the span, as returned by `now`.
+    //! @param duration The length of the span in nanoseconds.
+
+    inline void record(char const* const name, Phase const phase, std::int64_t const start,
+                       std::int64_t const duration) {
+        if (not samples->push({name, phase, currentFrame, start, duration})) {
+            droppedSamples.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    //! @brief Count the creation of a graphics object of the given kind in the current frame.
+    //! @param resource The kind of object that was created.
+
+    inline void countCreation(Resource const resource) {
+        creations[static_cast<std::size_t>(resource)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //! @brief Get the number of nanoseconds since the profiler was created.
+
+    [[nodiscard]] inline std::int64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch).count();
+    }
+
+public:
+    //! @brief Move the samples and frames recorded so far into the profiler's history.
+
+    void collect();
+
+    //! @brief Discard the profiler's history and any samples or frames that have not been collected.
+
+    void clear();
+
+    //! @brief Get the collected samples in the order in which they were recorded.
+
+    [[nodiscard]] inline std::vector<Sample> const& getSamples() const {
+        return sampleHistory;
+    }
+
+    //! @brief Get the collected frames in the order in which they ended.
+
+    [[nodiscard]] inline std::vector<FrameRecord> const& getFrames() const {
+        return frameHistory;
+    }
+
+    //! @brief Get the number of samples that were dropped because the ring was full.
+
+    [[nodiscard]] inline std::size_t getDroppedSamples() const {
+        return droppedSamples.load(std::memory_order_relaxed);
+    }
+
+    //! @brief Summarise the collected samples by component type and phase, in descending order of total time.
+
+    [[nodiscard]] std::vector<Summary> summarise() const;
+
+    //! @brief Write the collected samples and frames as a Chrome trace, which can be opened in `chrome://tracing`.
+    //! @param stream The stream to be written to.
+
+    void writeChromeTrace(std::ostream& stream) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    Clock::time_point epoch;
+    std::int64_t frameStart {0};
+    std::uint32_t currentFrame {0};
+
+private:
+    std::unique_ptr<concurrency::SpscRing<Sample, SampleCapacity>> samples;
+    std::unique_ptr<concurrency::SpscRing<FrameRecord, FrameCapacity>> frames;
+    std::array<std::atomic<std::uint32_t>, 3> creations {};
+    std::atomic<std::size_t> droppedSamples {0};
+
+private:
+    std::vector<Sample> sampleHistory;
+    std::vector<FrameRecord> frameHistory;
+};
+
+//! @class A guard that records the time between its construction and destruction as a sample.
+
+class ScopedSample {
+public:
+    //! @brief Start timing a span of work.
+    //! @param name The name of the component type, which must outlive the profiler.
+    //! @param phase The kind of work.
+    //! @param profiler The profiler that the sample should be recorded by.
+
+    ScopedSample(char const* const name, Phase const phase, Profiler& profiler = Profiler::get()):
+            name(name), phase(phase), profiler(profiler), start(profiler.now()) {
+    }
+
+    ScopedSample(ScopedSample const&) = delete;
+    ScopedSample& operator=(ScopedSample const&) = delete;
+
+    ~ScopedSample() {
+        profiler.record(name, phase, start, profiler.now() - start);
+    }
+
+private:
+    char const* name;
+    Phase phase;
+    Profiler& profiler;
+    std::int64_t start;
+};
+
+}
+
+//! @note Instrumentation is compiled in only if `DS_ENABLE_PROFILING` is defined. Otherwise, each macro expands to
+//! nothing and its arguments are not evaluated.
+
+#if defined(DS_ENABLE_PROFILING)
+#define DS_PROFILE_JOIN_NAME(a, b) a##b
+#define DS_PROFILE_NAME(a, b) DS_PROFILE_JOIN_NAME(a, b)
+#define DS_PROFILE_SCOPE(name, phase) \
+    ::ds::profiling::ScopedSample DS_PROFILE_NAME(profileSample, __LINE__) {name, ::ds::profiling::Phase::phase}
+#define DS_PROFILE_CREATION(resource) \
+    ::ds::profiling::Profiler::get().countCreation(::ds::profiling::Resource::resource)
+#define DS_PROFILE_FRAME_BEGIN() ::ds::profiling::Profiler::get().beginFrame()
+#define DS_PROFILE_FRAME_END() ::ds::profiling::Profiler::get().endFrame()
+#else
+#define DS_PROFILE_SCOPE(name, phase) static_cast<void>(0)
+#define DS_PROFILE_CREATION(resource) static_cast<void>(0)
+#define DS_PROFILE_FRAME_BEGIN() static_cast<void>(0)
+#define DS_PROFILE_FRAME_END() static_cast<void>(0)
+#endif
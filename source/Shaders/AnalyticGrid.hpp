@@ -0,0 +1,80 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <string>
+
+namespace ds::ui::shader {
+
+//! @brief A vertex shader that stretches a unit rectangle over the region covered by a grid's lines.
+
+inline std::string const& AnalyticGridVertex() {
+    static std::string const Vertex = R"(
+    #version 150
+
+    uniform mat4 ciModelViewProjection;
+    uniform vec4 gridExtent;
+
+    in vec4 ciPosition;
+    in vec4 ciColor;
+
+    out vec2 gridPosition;
+    out vec4 vertColor;
+
+    void main(void) {
+        gridPosition = gridExtent.xy + ciPosition.xy * gridExtent.zw;
+        vertColor    = ciColor;
+        gl_Position  = ciModelViewProjection * vec4(gridPosition, 0.0, 1.0);
+    }
+    )";
+
+    return Vertex;
+}
+
+//! @brief A fragment shader that computes the coverage of a grid's lines analytically.
+//! @note `lineCoverage` is mirrored by `getGridLineCoverage`, which must be kept in step with it.
+
+inline std::string const& AnalyticGridFragment() {
+    static std::string const Fragment = R"(
+    #version 150
+
+    uniform vec2  gridSpacing;
+    uniform vec2  gridDimensions;
+    uniform float LineThickness;
+
+    in  vec2 gridPosition;
+    in  vec4 vertColor;
+    out vec4 fragColor;
+
+    float lineCoverage(float across, float along, float spacing, float lines, float lengthAlong, float pixel) {
+        float nearest  = clamp(floor(across / spacing + 0.5), 0.0, lines);
+        float distance = abs(across - nearest * spacing);
+        float overhang = max(-along, along - lengthAlong);
+
+        float acrossCoverage = clamp((LineThickness - distance) / pixel + 0.5, 0.0, 1.0);
+        float alongCoverage  = clamp((LineThickness - overhang) / pixel + 0.5, 0.0, 1.0);
+
+        return acrossCoverage * alongCoverage;
+    }
+
+    void main(void) {
+        vec2  size  = gridSpacing * gridDimensions;
+        float pixel = max(fwidth(gridPosition.x), 1e-4);
+
+        float vertical   = lineCoverage(gridPosition.x, gridPosition.y, gridSpacing.x, gridDimensions.x, size.y, pixel);
+        float horizontal = lineCoverage(gridPosition.y, gridPosition.x, gridSpacing.y, gridDimensions.y, size.x, pixel);
+        float coverage   = max(vertical, horizontal);
+
+        if (coverage <= 0.0) {
+            discard;
+        }
+
+        fragColor = vec4(vertColor.rgb, vertColor.a * coverage);
+    }
+    )";
+
+    return Fragment;
+}
+
+}
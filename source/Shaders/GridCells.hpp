@@ -7,24 +7,27 @@
 
 namespace ds::ui::shader {
 
-inline std::string GridCellsVertex() {
+inline std::string const& GridCellsVertex() {
     static std::string const Vertex = R"(
     #version 150
 
     uniform mat4 ciModelViewProjection;
     uniform vec2 gridSpacing;
+    uniform ivec2 gridFirstCell;
+    uniform int gridColumns;
+    uniform float cellRadius;
 
-    in vec4 iPositionAndRadius;
     in vec4 ciPosition;
     in vec4 ciColor;
 
     out vec4 vertColor;
 
     void main(void) {
+        ivec2 cell = gridFirstCell + ivec2(gl_InstanceID % gridColumns, gl_InstanceID / gridColumns);
+
         vec4 position = ciPosition;
-        position.xyz *= iPositionAndRadius.w;
-        position.xyz += iPositionAndRadius.xyz * vec3(gridSpacing, 1.0f);
-        position.xy  += gridSpacing * 0.5;
+        position.xy *= cellRadius;
+        position.xy += (vec2(cell) + 0.5) * gridSpacing;
 
         vertColor   = ciColor;
         gl_Position = ciModelViewProjection * position;
@@ -34,7 +37,7 @@ inline std::string GridCellsVertex() {
     return Vertex;
 }
 
-inline std::string GridCellsFragment() {
+inline std::string const& GridCellsFragment() {
     static std::string const Fragment = R"(
     #version 150
 
@@ -10,7 +10,7 @@ namespace ds::ui::shader {
 //! @author Paul Houx
 //! @url License: https://github.com/paulhoux/Cinder-Samples/tree/master/GeometryShader
 
-inline std::string LinesVertex() {
+inline std::string const& LinesVertex() {
     static std::string const Vertex = R"(
     #version 150
 
@@ -33,10 +33,44 @@ inline std::string LinesVertex() {
     return Vertex;
 }
 
+//! @brief A vertex shader for `LinesGeometry` that positions each `GridLineVertex` from the grid's dimensions and
+//! spacing, so that neither needs the vertex buffer to be rebuilt when it changes.
+
+inline std::string const& GridLinesVertex() {
+    static std::string const Vertex = R"(
+    #version 150
+
+    uniform mat4 ciModelViewProjection;
+    uniform vec2 gridSpacing;
+    uniform vec2 gridDimensions;
+
+    in vec4 iGridLine;
+    in vec3 ciColor;
+
+    out VertexData{
+        vec3 mColor;
+    } VertexOut;
+
+    void main(void)
+    {
+        bool  isVertical = iGridLine.x > 0.5;
+        float across = isVertical ? gridDimensions.x : gridDimensions.y;
+        float along  = isVertical ? gridDimensions.y : gridDimensions.x;
+        float line   = iGridLine.y + iGridLine.w * across;
+        vec2  grid   = isVertical ? vec2(line, iGridLine.z * along) : vec2(iGridLine.z * along, line);
+
+        VertexOut.mColor = ciColor;
+        gl_Position = ciModelViewProjection * vec4(grid * gridSpacing, 0.0, 1.0);
+    }
+    )";
+
+    return Vertex;
+}
+
 //! @author Paul Houx
 //! @url License: https://github.com/paulhoux/Cinder-Samples/tree/master/GeometryShader
 
-inline std::string LinesFragment() {
+inline std::string const& LinesFragment() {
     static std::string const Fragment = R"(
     #version 150
 
@@ -59,7 +93,7 @@ inline std::string LinesFragment() {
 //! @author Paul Houx
 //! @url License: https://github.com/paulhoux/Cinder-Samples/tree/master/GeometryShader
 
-inline std::string LinesGeometry() {
+inline std::string const& LinesGeometry() {
     static std::string const Geometry = R"(
     #version 150
 
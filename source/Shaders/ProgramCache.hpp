@@ -0,0 +1,139 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+
+namespace ds::ui::shader {
+
+//! @struct The sources and format of a shader program.
+//! @note The sources are not owned, so they need only outlive the call that they are passed to.
+
+struct ProgramSource {
+    int version {150};
+    std::string_view vertex {};
+    std::string_view fragment {};
+    std::string_view geometry {};
+
+public:
+    //! @brief Compute a hash of the sources and format.
+
+    [[nodiscard]] inline std::size_t hash() const {
+        auto const hasher = std::hash<std::string_view>();
+        auto seed = std::hash<int>()(version);
+
+        for (auto const source: {vertex, fragment, geometry}) {
+            seed ^= hasher(source) + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+        }
+
+        return seed;
+    }
+};
+
+//! @class A cache of linked shader programs keyed by their sources and format.
+//! @note Programs are shared by every caller that requests the same sources, so uniforms that differ between
+//! callers must be set before each draw rather than when the program is created. The cache is not thread-safe
+//! and should only be used on the thread that owns the graphics context.
+
+template <typename ProgramRef>
+class ProgramCache {
+public:
+    //! @struct Counters describing the requests made of the cache.
+
+    struct Statistics {
+        std::size_t hits {0};
+        std::size_t misses {0};
+    };
+
+public:
+    ProgramCache() = default;
+
+public:
+    //! @brief Get the program with the given sources, creating it if it does not exist.
+    //! @param source The sources and format of the desired program.
+    //! @param create A callable that creates a `ProgramRef` from a `ProgramSource` when the cache misses.
+
+    template <typename Factory>
+    ProgramRef get(ProgramSource const& source, Factory&& create) {
+        auto& bucket = programs[source.hash()];
+
+        for (auto const& entry: bucket) {
+            if (entry.isEqual(source)) {
+                ++stats.hits;
+                return entry.program;
+            }
+        }
+
+        ++stats.misses;
+
+        auto program = create(source);
+        bucket.push_back({source.version,
+                          std::string(source.vertex),
+                          std::string(source.fragment),
+                          std::string(source.geometry),
+                          program});
+
+        return program;
+    }
+
+    //! @brief Remove every program from the cache.
+
+    inline void clear() {
+        programs.clear();
+    }
+
+public:
+    //! @brief Get the number of programs in the cache.
+
+    [[nodiscard]] inline std::size_t size() const {
+        std::size_t count = 0;
+        for (auto const& [hash, bucket]: programs) {
+            count = count + bucket.size();
+        }
+
+        return count;
+    }
+
+    //! @brief Get the cache's counters.
+
+    [[nodiscard]] inline Statistics const& statistics() const {
+        return stats;
+    }
+
+    //! @brief Reset the cache's counters.
+
+    inline void resetStatistics() {
+        stats = {};
+    }
+
+private:
+    struct Entry {
+        int version;
+        std::string vertex;
+        std::string fragment;
+        std::string geometry;
+        ProgramRef program;
+
+    public:
+        [[nodiscard]] inline bool isEqual(ProgramSource const& source) const {
+            return version == source.version and
+                   vertex == source.vertex and
+                   fragment == source.fragment and
+                   geometry == source.geometry;
+        }
+    };
+
+private:
+    std::unordered_map<std::size_t, std::vector<Entry>> programs;
+
+private:
+    Statistics stats {};
+};
+
+}
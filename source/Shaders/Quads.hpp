@@ -0,0 +1,49 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <string>
+
+namespace ds::ui::shader {
+
+inline std::string const& QuadsVertex() {
+    static std::string const Vertex = R"(
+    #version 150
+
+    uniform mat4 ciModelViewProjection;
+
+    in vec4 iRect;
+    in vec4 iColour;
+    in vec4 ciPosition;
+
+    out vec4 vertColor;
+
+    void main(void) {
+        vec4 position = ciPosition;
+        position.xy  = iRect.xy + position.xy * iRect.zw;
+
+        vertColor   = iColour;
+        gl_Position = ciModelViewProjection * position;
+    }
+    )";
+
+    return Vertex;
+}
+
+inline std::string const& QuadsFragment() {
+    static std::string const Fragment = R"(
+    #version 150
+
+    in  vec4 vertColor;
+    out vec4 fragColor;
+
+    void main(void) {
+        fragColor = vertColor;
+    }
+    )";
+
+    return Fragment;
+}
+
+}
@@ -3,15 +3,45 @@
 
 #pragma once
 
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
 #include "Size.hpp"
 #include "Point.hpp"
 
 namespace ds::ui {
 
-//! @class A rectangular bounding box.
+//! @enum Parameters for a Bounds that define how it is stored.
+//! @note A `Cached` bounds stores its centre point alongside its origin and size, while a `Compact` bounds
+//! stores only its origin and size and derives its centre point when it is requested.
+
+enum class BoundsStorage {
+    Cached, Compact
+};
+
+template <typename T, BoundsStorage Storage>
+class Bounds;
+
+//! @class An object that is told whenever a bounds that it observes is moved or resized.
 
 template <typename T>
+class BoundsObserver {
+public:
+    virtual ~BoundsObserver() = default;
+
+    //! @brief Respond to a change in the position or size of the given bounds.
+    //! @param bounds The observed bounds, whose position or size has changed.
+
+    virtual void boundsDidChange(Bounds<T, BoundsStorage::Cached> const& bounds) = 0;
+};
+
+//! @class A rectangular bounding box.
+
+template <typename T, BoundsStorage Storage = BoundsStorage::Cached>
 class Bounds {
+private:
+    static constexpr bool isCompact = Storage == BoundsStorage::Compact;
+
 public:
     //! @brief Construct an empty bounds at position (0, 0).
 
@@ -53,8 +83,46 @@ public:
         setSizeFromOrigin(width, height);
     }
 
+    //! @brief Copy the position and size of the given bounds.
+    //! @note The copy is not observed by the given bounds' observer.
+
+    Bounds(Bounds const& other):
+            m_size(other.m_size), m_origin(other.m_origin), m_centre(other.m_centre) {
+    }
+
+    //! @brief Take the position and size of the given bounds, keeping the bounds' own observer.
+
+    Bounds& operator=(Bounds const& other) {
+        m_size = other.m_size;
+        m_origin = other.m_origin;
+        m_centre = other.m_centre;
+        notifyObserver();
+
+        return *this;
+    }
+
     virtual ~Bounds() = default;
 
+public:
+    //! @brief Set the object that should be told whenever the bounds is moved or resized.
+    //! @note A bounds has at most one observer, which must remove itself before it is destroyed. Setting an observer
+    //! while another is set throws a `std::logic_error`, so an observer is never silently replaced.
+    //! @param observer The observer, or `nullptr` to remove the current observer.
+
+    inline void setObserver(BoundsObserver<T>* const observer) const requires (not isCompact) {
+        if (observer != nullptr and m_observer != nullptr and m_observer != observer) {
+            throw std::logic_error("The bounds is already observed by another object.");
+        }
+
+        m_observer = observer;
+    }
+
+    //! @brief Get the object that is told whenever the bounds is moved or resized, if any.
+
+    [[nodiscard]] inline BoundsObserver<T>* getObserver() const requires (not isCompact) {
+        return m_observer;
+    }
+
 public:
     //! @brief Get the size of the bounds.
 
@@ -70,8 +138,12 @@ public:
 
     //! @brief Get the centre point.
 
-    inline ds::ui::Point<T> const& centre() const {
-        return m_centre;
+    inline std::conditional_t<isCompact, ds::ui::Point<T>, ds::ui::Point<T> const&> centre() const {
+        if constexpr (isCompact) {
+            return {m_origin.x + half(m_size.w), m_origin.y + half(m_size.h)};
+        } else {
+            return m_centre;
+        }
     }
 
     //! @brief Indicate whether the given point falls within the bounds.
@@ -88,6 +160,17 @@ public:
                static_cast<T>(xy.y) <= m_origin.y + m_size.h;
     }
 
+    //! @brief Indicate whether the given bounds overlaps or touches the bounds.
+    //! @param other The bounds to be tested.
+
+    template <BoundsStorage OtherStorage>
+    inline bool intersects(Bounds<T, OtherStorage> const& other) const {
+        return other.origin().x <= m_origin.x + m_size.w &&
+               other.origin().y <= m_origin.y + m_size.h &&
+               m_origin.x <= other.origin().x + other.size().w &&
+               m_origin.y <= other.origin().y + other.size().h;
+    }
+
 public:
     //! @brief Get the upper left point (i.e., the origin).
 
@@ -217,6 +300,37 @@ public:
         return withSizeFromCentre(size().w, height);
     }
 
+    //! @brief Produce the smallest bounds that contains both the bounds and the given bounds.
+    //! @param other The bounds to be united with the bounds.
+
+    template <BoundsStorage OtherStorage>
+    [[nodiscard]] inline ds::ui::Bounds<T> withUnion(Bounds<T, OtherStorage> const& other) const {
+        auto const x0 = std::min(origin().x, other.origin().x);
+        auto const y0 = std::min(origin().y, other.origin().y);
+        auto const x1 = std::max(origin().x + size().w, other.origin().x + other.size().w);
+        auto const y1 = std::max(origin().y + size().h, other.origin().y + other.size().h);
+
+        return {x0, y0, x1 - x0, y1 - y0};
+    }
+
+    //! @brief Produce the region shared by the bounds and the given bounds.
+    //! @param other The bounds to be intersected with the bounds.
+    //! @note If the bounds do not intersect, then the result has zero size.
+
+    template <BoundsStorage OtherStorage>
+    [[nodiscard]] inline ds::ui::Bounds<T> withIntersection(Bounds<T, OtherStorage> const& other) const {
+        auto const x0 = std::max(origin().x, other.origin().x);
+        auto const y0 = std::max(origin().y, other.origin().y);
+        auto const x1 = std::min(origin().x + size().w, other.origin().x + other.size().w);
+        auto const y1 = std::min(origin().y + size().h, other.origin().y + other.size().h);
+
+        if (x1 < x0 or y1 < y0) {
+            return {x0, y0, static_cast<T>(0), static_cast<T>(0)};
+        }
+
+        return {x0, y0, x1 - x0, y1 - y0};
+    }
+
 public:
     //! @brief Set the size of the bounds, anchored at the origin.
     //! @param width The desired width.
@@ -240,9 +354,10 @@ public:
     //! @param height The desired height.
 
     inline void setSizeFromCentre(T const width, T const height) {
+        auto const previousCentre = ds::ui::Point<T>(centre());
         m_size.w = std::max(static_cast<T>(0), width);
         m_size.h = std::max(static_cast<T>(0), height);
-        setPositionWithCentre(m_centre.x, m_centre.y);
+        setPositionWithCentre(previousCentre.x, previousCentre.y);
     }
 
     //! @brief Set the size of the bounds, anchored at the centre point.
@@ -297,8 +412,13 @@ public:
     inline void setPositionWithOrigin(T const x, T const y) {
         m_origin.x = x;
         m_origin.y = y;
-        m_centre.x = x + static_cast<T>(static_cast<float>(m_size.w) * 0.5f);
-        m_centre.y = y + static_cast<T>(static_cast<float>(m_size.h) * 0.5f);
+
+        if constexpr (not isCompact) {
+            m_centre.x = x + half(m_size.w);
+            m_centre.y = y + half(m_size.h);
+        }
+
+        notifyObserver();
     }
 
     //! @brief Set the position from the given origin point.
@@ -313,10 +433,15 @@ public:
     //! @param y The y-coordinate of the desired centre point.
 
     inline void setPositionWithCentre(T const x, T const y) {
-        m_centre.x = x;
-        m_centre.y = y;
-        m_origin.x = x - static_cast<T>(static_cast<float>(m_size.w) * 0.5f);
-        m_origin.y = y - static_cast<T>(static_cast<float>(m_size.h) * 0.5f);
+        m_origin.x = x - half(m_size.w);
+        m_origin.y = y - half(m_size.h);
+
+        if constexpr (not isCompact) {
+            m_centre.x = x;
+            m_centre.y = y;
+        }
+
+        notifyObserver();
     }
 
     //! @brief Set the position from the given centre point.
@@ -435,10 +560,54 @@ public:
         return {origin().x, origin().y + size().h, size().w, amountToTrim};
     }
 
+private:
+    //! @brief Compute half of the given non-negative length, using integer division for integral types.
+    //! @param length The length to be halved.
+
+    static inline T half(T const length) {
+        if constexpr (std::is_integral_v<T>) {
+            return length / static_cast<T>(2);
+        } else if constexpr (std::is_same_v<T, float>) {
+            return length * 0.5f;
+        } else {
+            return static_cast<T>(static_cast<float>(length) * 0.5f);
+        }
+    }
+
+    //! @brief Tell the observer, if any, that the bounds has been moved or resized.
+
+    inline void notifyObserver() const {
+        if constexpr (not isCompact) {
+            if (m_observer != nullptr) {
+                m_observer->boundsDidChange(*this);
+            }
+        }
+    }
+
+private:
+    struct NoCentre {
+    };
+
+    struct NoObserver {
+    };
+
 protected:
     ds::ui::Size<T> m_size {};
     ds::ui::Point<T> m_origin {};
-    ds::ui::Point<T> m_centre {};
+    [[no_unique_address]] std::conditional_t<isCompact, NoCentre, ds::ui::Point<T>> m_centre {};
+
+private:
+    [[no_unique_address]] mutable std::conditional_t<isCompact, NoObserver, BoundsObserver<T>*> m_observer {};
 };
 
+//! @class A rectangular bounding box that stores only its origin and size.
+
+template <typename T>
+using CompactBounds = Bounds<T, BoundsStorage::Compact>;
+
+// Each bounds holds a vtable pointer, and a cached bounds also holds its centre and observer.
+
+static_assert(sizeof(CompactBounds<float>) == sizeof(void*) + 4 * sizeof(float));
+static_assert(sizeof(Bounds<float>) == 2 * sizeof(void*) + 6 * sizeof(float));
+
 }
\ No newline at end of file
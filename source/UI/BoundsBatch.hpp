@@ -0,0 +1,302 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <span>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#include "Point.hpp"
+#include "Bounds.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace ds::ui {
+
+//! @struct A structure-of-arrays view of a sequence of points.
+
+template <typename T>
+struct PointSpan {
+    std::span<T const> x;
+    std::span<T const> y;
+
+    [[nodiscard]] inline std::size_t size() const {
+        return std::min(x.size(), y.size());
+    }
+};
+
+//! @struct A structure-of-arrays view of a sequence of bounds.
+
+template <typename T>
+struct BoundsSpan {
+    std::span<T const> x;
+    std::span<T const> y;
+    std::span<T const> width;
+    std::span<T const> height;
+
+    [[nodiscard]] inline std::size_t size() const {
+        return std::min({x.size(), y.size(), width.size(), height.size()});
+    }
+};
+
+//! @brief Get the number of 64-bit words required to hold a bitmask of the given length.
+//! @param count The number of bits in the bitmask.
+
+constexpr std::size_t getMaskWordCount(std::size_t const count) {
+    return (count + 63) / 64;
+}
+
+namespace scalar {
+
+//! @brief Test each of the given points against the given bounds, as `Bounds<T>::contains` would.
+//! @param bounds The bounds to test against.
+//! @param points The points to be tested.
+//! @param mask A bitmask whose i-th bit is set if and only if the i-th point lies within the bounds.
+
+template <typename T, BoundsStorage Storage>
+void containsEach(Bounds<T, Storage> const& bounds, PointSpan<T> const& points, std::span<std::uint64_t> const mask) {
+    auto const count = points.size();
+    std::fill_n(mask.begin(), getMaskWordCount(count), 0);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        auto const isContained = bounds.contains(Point<T>(points.x[i], points.y[i]));
+        mask[i / 64] |= static_cast<std::uint64_t>(isContained) << (i % 64);
+    }
+}
+
+//! @brief Test the given point against each of the given bounds, as `Bounds<T>::contains` would.
+//! @param point The point to be tested.
+//! @param bounds The bounds to test against.
+//! @param mask A bitmask whose i-th bit is set if and only if the i-th bounds contains the point.
+
+template <typename T>
+void containedByEach(Point<T> const& point, BoundsSpan<T> const& bounds, std::span<std::uint64_t> const mask) {
+    auto const count = bounds.size();
+    std::fill_n(mask.begin(), getMaskWordCount(count), 0);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        auto const isContained = point.x >= bounds.x[i] and
+                                 point.y >= bounds.y[i] and
+                                 point.x <= bounds.x[i] + bounds.width[i] and
+                                 point.y <= bounds.y[i] + bounds.height[i];
+        mask[i / 64] |= static_cast<std::uint64_t>(isContained) << (i % 64);
+    }
+}
+
+}
+
+//! @brief Test each of the given points against the given bounds.
+//! @note The result is identical to that of `scalar::containsEach`, and SIMD instructions are used for
+//! `float` and `std::int32_t` where the target supports them.
+//! @param bounds The bounds to test against.
+//! @param points The points to be tested.
+//! @param mask A bitmask whose i-th bit is set if and only if the i-th point lies within the bounds.
+
+template <typename T, BoundsStorage Storage>
+void containsEach(Bounds<T, Storage> const& bounds, PointSpan<T> const& points, std::span<std::uint64_t> const mask) {
+    auto const count = points.size();
+    std::fill_n(mask.begin(), getMaskWordCount(count), 0);
+
+    auto const left = bounds.origin().x;
+    auto const top = bounds.origin().y;
+    auto const right = bounds.origin().x + bounds.size().w;
+    auto const bottom = bounds.origin().y + bounds.size().h;
+
+    std::size_t i = 0;
+
+#if defined(__AVX__)
+    if constexpr (std::is_same_v<T, float>) {
+        auto const l = _mm256_set1_ps(left), t = _mm256_set1_ps(top);
+        auto const r = _mm256_set1_ps(right), b = _mm256_set1_ps(bottom);
+
+        for (; i + 8 <= count; i += 8) {
+            auto const x = _mm256_loadu_ps(points.x.data() + i);
+            auto const y = _mm256_loadu_ps(points.y.data() + i);
+            auto const inside = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(x, l, _CMP_GE_OQ), _mm256_cmp_ps(y, t, _CMP_GE_OQ)),
+                                              _mm256_and_ps(_mm256_cmp_ps(x, r, _CMP_LE_OQ), _mm256_cmp_ps(y, b, _CMP_LE_OQ)));
+            mask[i / 64] |= static_cast<std::uint64_t>(_mm256_movemask_ps(inside)) << (i % 64);
+        }
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    if constexpr (std::is_same_v<T, float>) {
+        auto const l = _mm_set1_ps(left), t = _mm_set1_ps(top);
+        auto const r = _mm_set1_ps(right), b = _mm_set1_ps(bottom);
+
+        for (; i + 4 <= count; i += 4) {
+            auto const x = _mm_loadu_ps(points.x.data() + i);
+            auto const y = _mm_loadu_ps(points.y.data() + i);
+            auto const inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(x, l), _mm_cmpge_ps(y, t)),
+                                           _mm_and_ps(_mm_cmple_ps(x, r), _mm_cmple_ps(y, b)));
+            mask[i / 64] |= static_cast<std::uint64_t>(_mm_movemask_ps(inside)) << (i % 64);
+        }
+    }
+#endif
+
+#if defined(__AVX2__)
+    if constexpr (std::is_same_v<T, std::int32_t>) {
+        auto const l = _mm256_set1_epi32(left), t = _mm256_set1_epi32(top);
+        auto const r = _mm256_set1_epi32(right), b = _mm256_set1_epi32(bottom);
+
+        for (; i + 8 <= count; i += 8) {
+            auto const x = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(points.x.data() + i));
+            auto const y = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(points.y.data() + i));
+            auto const outside = _mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi32(l, x), _mm256_cmpgt_epi32(t, y)),
+                                                 _mm256_or_si256(_mm256_cmpgt_epi32(x, r), _mm256_cmpgt_epi32(y, b)));
+            auto const bits = ~_mm256_movemask_ps(_mm256_castsi256_ps(outside)) & 0xFF;
+            mask[i / 64] |= static_cast<std::uint64_t>(bits) << (i % 64);
+        }
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    if constexpr (std::is_same_v<T, std::int32_t>) {
+        auto const l = _mm_set1_epi32(left), t = _mm_set1_epi32(top);
+        auto const r = _mm_set1_epi32(right), b = _mm_set1_epi32(bottom);
+
+        for (; i + 4 <= count; i += 4) {
+            auto const x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(points.x.data() + i));
+            auto const y = _mm_loadu_si128(reinterpret_cast<__m128i const*>(points.y.data() + i));
+            auto const outside = _mm_or_si128(_mm_or_si128(_mm_cmpgt_epi32(l, x), _mm_cmpgt_epi32(t, y)),
+                                              _mm_or_si128(_mm_cmpgt_epi32(x, r), _mm_cmpgt_epi32(y, b)));
+            auto const bits = ~_mm_movemask_ps(_mm_castsi128_ps(outside)) & 0xF;
+            mask[i / 64] |= static_cast<std::uint64_t>(bits) << (i % 64);
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        auto const isContained = points.x[i] >= left and points.y[i] >= top and
+                                 points.x[i] <= right and points.y[i] <= bottom;
+        mask[i / 64] |= static_cast<std::uint64_t>(isContained) << (i % 64);
+    }
+}
+
+//! @brief Test the given point against each of the given bounds.
+//! @note The result is identical to that of `scalar::containedByEach`, and SIMD instructions are used for
+//! `float` and `std::int32_t` where the target supports them.
+//! @param point The point to be tested.
+//! @param bounds The bounds to test against.
+//! @param mask A bitmask whose i-th bit is set if and only if the i-th bounds contains the point.
+
+template <typename T>
+void containedByEach(Point<T> const& point, BoundsSpan<T> const& bounds, std::span<std::uint64_t> const mask) {
+    auto const count = bounds.size();
+    std::fill_n(mask.begin(), getMaskWordCount(count), 0);
+
+    std::size_t i = 0;
+
+#if defined(__AVX__)
+    if constexpr (std::is_same_v<T, float>) {
+        auto const px = _mm256_set1_ps(point.x), py = _mm256_set1_ps(point.y);
+
+        for (; i + 8 <= count; i += 8) {
+            auto const x = _mm256_loadu_ps(bounds.x.data() + i);
+            auto const y = _mm256_loadu_ps(bounds.y.data() + i);
+            auto const r = _mm256_add_ps(x, _mm256_loadu_ps(bounds.width.data() + i));
+            auto const b = _mm256_add_ps(y, _mm256_loadu_ps(bounds.height.data() + i));
+            auto const inside = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(px, x, _CMP_GE_OQ), _mm256_cmp_ps(py, y, _CMP_GE_OQ)),
+                                              _mm256_and_ps(_mm256_cmp_ps(px, r, _CMP_LE_OQ), _mm256_cmp_ps(py, b, _CMP_LE_OQ)));
+            mask[i / 64] |= static_cast<std::uint64_t>(_mm256_movemask_ps(inside)) << (i % 64);
+        }
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    if constexpr (std::is_same_v<T, float>) {
+        auto const px = _mm_set1_ps(point.x), py = _mm_set1_ps(point.y);
+
+        for (; i + 4 <= count; i += 4) {
+            auto const x = _mm_loadu_ps(bounds.x.data() + i);
+            auto const y = _mm_loadu_ps(bounds.y.data() + i);
+            auto const r = _mm_add_ps(x, _mm_loadu_ps(bounds.width.data() + i));
+            auto const b = _mm_add_ps(y, _mm_loadu_ps(bounds.height.data() + i));
+            auto const inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(px, x), _mm_cmpge_ps(py, y)),
+                                           _mm_and_ps(_mm_cmple_ps(px, r), _mm_cmple_ps(py, b)));
+            mask[i / 64] |= static_cast<std::uint64_t>(_mm_movemask_ps(inside)) << (i % 64);
+        }
+    }
+#endif
+
+#if defined(__AVX2__)
+    if constexpr (std::is_same_v<T, std::int32_t>) {
+        auto const px = _mm256_set1_epi32(point.x), py = _mm256_set1_epi32(point.y);
+
+        for (; i + 8 <= count; i += 8) {
+            auto const x = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(bounds.x.data() + i));
+            auto const y = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(bounds.y.data() + i));
+            auto const w = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(bounds.width.data() + i));
+            auto const h = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(bounds.height.data() + i));
+            auto const r = _mm256_add_epi32(x, w);
+            auto const b = _mm256_add_epi32(y, h);
+            auto const outside = _mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi32(x, px), _mm256_cmpgt_epi32(y, py)),
+                                                 _mm256_or_si256(_mm256_cmpgt_epi32(px, r), _mm256_cmpgt_epi32(py, b)));
+            auto const bits = ~_mm256_movemask_ps(_mm256_castsi256_ps(outside)) & 0xFF;
+            mask[i / 64] |= static_cast<std::uint64_t>(bits) << (i % 64);
+        }
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    if constexpr (std::is_same_v<T, std::int32_t>) {
+        auto const px = _mm_set1_epi32(point.x), py = _mm_set1_epi32(point.y);
+
+        for (; i + 4 <= count; i += 4) {
+            auto const x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(bounds.x.data() + i));
+            auto const y = _mm_loadu_si128(reinterpret_cast<__m128i const*>(bounds.y.data() + i));
+            auto const w = _mm_loadu_si128(reinterpret_cast<__m128i const*>(bounds.width.data() + i));
+            auto const h = _mm_loadu_si128(reinterpret_cast<__m128i const*>(bounds.height.data() + i));
+            auto const r = _mm_add_epi32(x, w);
+            auto const b = _mm_add_epi32(y, h);
+            auto const outside = _mm_or_si128(_mm_or_si128(_mm_cmpgt_epi32(x, px), _mm_cmpgt_epi32(y, py)),
+                                              _mm_or_si128(_mm_cmpgt_epi32(px, r), _mm_cmpgt_epi32(py, b)));
+            auto const bits = ~_mm_movemask_ps(_mm_castsi128_ps(outside)) & 0xF;
+            mask[i / 64] |= static_cast<std::uint64_t>(bits) << (i % 64);
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        auto const isContained = point.x >= bounds.x[i] and
+                                 point.y >= bounds.y[i] and
+                                 point.x <= bounds.x[i] + bounds.width[i] and
+                                 point.y <= bounds.y[i] + bounds.height[i];
+        mask[i / 64] |= static_cast<std::uint64_t>(isContained) << (i % 64);
+    }
+}
+
+//! @brief Translate each of the given points by the given vector.
+//! @param x The x-coordinates of the points to be translated.
+//! @param y The y-coordinates of the points to be translated.
+//! @param delta The translation vector.
+
+template <typename T>
+void translateEach(std::span<T> const x, std::span<T> const y, Point<T> const& delta) {
+    auto const dx = delta.x;
+    auto const dy = delta.y;
+
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] += dx;
+    }
+
+    for (std::size_t i = 0; i < y.size(); ++i) {
+        y[i] += dy;
+    }
+}
+
+//! @brief Scale each of the given points component-wise by the given vector.
+//! @param x The x-coordinates of the points to be scaled.
+//! @param y The y-coordinates of the points to be scaled.
+//! @param factor The scale vector.
+
+template <typename T>
+void scaleEach(std::span<T> const x, std::span<T> const y, Point<T> const& factor) {
+    auto const kx = factor.x;
+    auto const ky = factor.y;
+
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] *= kx;
+    }
+
+    for (std::size_t i = 0; i < y.size(); ++i) {
+        y[i] *= ky;
+    }
+}
+
+}
@@ -0,0 +1,482 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+#include "Bounds.hpp"
+#include "PointValue.hpp"
+
+namespace ds::ui {
+
+//! @class A trivially copyable, standard-layout rectangular bounding box that is usable in constant expressions.
+//! @note This is the value counterpart of `Bounds`, which it can be converted to and from. It has no vtable, so
+//! arrays of `BoundsValue` can be copied with `memcpy` or uploaded directly to a GPU buffer.
+
+template <typename T>
+class BoundsValue {
+public:
+    //! @brief Construct an empty bounds at position (0, 0).
+
+    constexpr BoundsValue() = default;
+
+    //! @brief Construct a bounds with the given size at position (0, 0).
+    //! @param size The desired size.
+
+    constexpr explicit BoundsValue(SizeValue<T> const& size):
+            BoundsValue(0, 0, size.x, size.y) {
+    }
+
+    //! @brief Construct a bounds with the given size at position (0, 0).
+    //! @param width The desired width.
+    //! @param height The desired height.
+
+    constexpr BoundsValue(T const width, T const height):
+            BoundsValue(0, 0, width, height) {
+    }
+
+    //! @brief Construct a bounds with the given size at the given origin point.
+    //! @param origin The desired origin point.
+    //! @param size The desired size.
+
+    constexpr BoundsValue(PointValue<T> const& origin, SizeValue<T> const& size):
+            BoundsValue(origin.x, origin.y, size.x, size.y) {
+    }
+
+    //! @brief Construct a bounds with the given size at the given origin point.
+    //! @param x The x-coordinate of the desired origin point.
+    //! @param y The y-coordinate of the desired origin point.
+    //! @param width The desired width.
+    //! @param height The desired height.
+
+    constexpr BoundsValue(T const x, T const y, T const width, T const height) {
+        setPositionWithOrigin(x, y);
+        setSizeFromOrigin(width, height);
+    }
+
+    //! @brief Construct a copy of the given bounds.
+    //! @param bounds The bounds to be copied.
+
+    template <BoundsStorage Storage>
+    explicit BoundsValue(Bounds<T, Storage> const& bounds):
+            m_size(SizeValue<T>::from(bounds.size())),
+            m_origin(PointValue<T>::from(bounds.origin())),
+            m_centre(PointValue<T>::from(bounds.centre())) {
+    }
+
+public:
+    //! @brief Create a `Bounds` with the same origin and size.
+
+    [[nodiscard]] inline Bounds<T> toBounds() const {
+        return {m_origin.x, m_origin.y, m_size.x, m_size.y};
+    }
+
+public:
+    //! @brief Get the size of the bounds.
+
+    [[nodiscard]] constexpr SizeValue<T> const& size() const {
+        return m_size;
+    }
+
+    //! @brief Get the origin point.
+
+    [[nodiscard]] constexpr PointValue<T> const& origin() const {
+        return m_origin;
+    }
+
+    //! @brief Get the centre point.
+
+    [[nodiscard]] constexpr PointValue<T> const& centre() const {
+        return m_centre;
+    }
+
+    //! @brief Indicate whether the given point falls within the bounds.
+    //! @param xy The point to be tested.
+
+    template <typename K>
+    [[nodiscard]] constexpr bool contains(PointValue<K> const& xy) const {
+        static_assert(std::is_integral_v<K> or std::is_floating_point_v<K>,
+                      "The given type must either be an integral or a floating point type.");
+
+        return static_cast<T>(xy.x) >= m_origin.x &&
+               static_cast<T>(xy.y) >= m_origin.y &&
+               static_cast<T>(xy.x) <= m_origin.x + m_size.x &&
+               static_cast<T>(xy.y) <= m_origin.y + m_size.y;
+    }
+
+    //! @brief Indicate whether the given point falls within the bounds.
+    //! @param xy The point to be tested.
+
+    template <typename K>
+    [[nodiscard]] inline bool contains(Point<K> const& xy) const {
+        return contains(PointValue<K> {xy.x, xy.y});
+    }
+
+    [[nodiscard]] constexpr bool operator==(BoundsValue const& other) const = default;
+
+public:
+    //! @brief Get the upper left point (i.e., the origin).
+
+    [[nodiscard]] constexpr PointValue<T> getUpperLeft() const {
+        return origin();
+    }
+
+    //! @brief Get the upper right point.
+
+    [[nodiscard]] constexpr PointValue<T> getUpperRight() const {
+        return origin() + PointValue<T> {size().x, 0};
+    }
+
+    //! @brief Get the lower left point.
+
+    [[nodiscard]] constexpr PointValue<T> getLowerLeft() const {
+        return origin() + PointValue<T> {0, size().y};
+    }
+
+    //! @brief Get the lower right point.
+
+    [[nodiscard]] constexpr PointValue<T> getLowerRight() const {
+        return origin() + size();
+    }
+
+public:
+    //! @brief Produce a copy with the given origin.
+    //! @param x The x-coordinate of the desired origin point.
+    //! @param y The y-coordinate of the desired origin point.
+
+    [[nodiscard]] constexpr BoundsValue withOrigin(T const x, T const y) const {
+        return {x, y, size().x, size().y};
+    }
+
+    //! @brief Produce a copy with the given origin.
+    //! @param xy The desired origin point.
+
+    [[nodiscard]] constexpr BoundsValue withOrigin(PointValue<T> const& xy) const {
+        return withOrigin(xy.x, xy.y);
+    }
+
+    //! @brief Produce a copy with the given centre point.
+    //! @param x The x-coordinate of the desired centre point.
+    //! @param y The y-coordinate of the desired centre point.
+
+    [[nodiscard]] constexpr BoundsValue withCentre(T const x, T const y) const {
+        return {x - size().x / static_cast<T>(2), y - size().y / static_cast<T>(2), size().x, size().y};
+    }
+
+    //! @brief Produce a copy with the given centre point.
+    //! @param xy The desired centre point.
+
+    [[nodiscard]] constexpr BoundsValue withCentre(PointValue<T> const& xy) const {
+        return withCentre(xy.x, xy.y);
+    }
+
+    //! @brief Produce a copy with the given translation.
+    //! @param x The x component of the desired translation vector.
+    //! @param y The y component of the desired translation vector.
+
+    [[nodiscard]] constexpr BoundsValue withTranslation(T const x, T const y) const {
+        return {origin().x + x, origin().y + y, size().x, size().y};
+    }
+
+    //! @brief Produce a copy with the given translation.
+    //! @param xy The desired translation vector.
+
+    [[nodiscard]] constexpr BoundsValue withTranslation(PointValue<T> const& xy) const {
+        return withTranslation(xy.x, xy.y);
+    }
+
+    //! @brief Produce a copy with the given size, anchored at the centre.
+    //! @param width The desired width.
+    //! @param height The desired height.
+
+    [[nodiscard]] constexpr BoundsValue withSizeFromCentre(T const width, T const height) const {
+        return {centre().x - half(width), centre().y - half(height), width, height};
+    }
+
+    //! @brief Produce a copy with the given size, anchored at the centre.
+    //! @param size The desired size.
+
+    [[nodiscard]] constexpr BoundsValue withSizeFromCentre(SizeValue<T> const& size) const {
+        return withSizeFromCentre(size.x, size.y);
+    }
+
+    //! @brief Produce a copy with the given size, anchored at the origin.
+    //! @param width The desired width.
+    //! @param height The desired height.
+
+    [[nodiscard]] constexpr BoundsValue withSizeFromOrigin(T const width, T const height) const {
+        return {origin().x, origin().y, width, height};
+    }
+
+    //! @brief Produce a copy with the given size, anchored at the origin.
+    //! @param size The desired size.
+
+    [[nodiscard]] constexpr BoundsValue withSizeFromOrigin(SizeValue<T> const& size) const {
+        return withSizeFromOrigin(size.x, size.y);
+    }
+
+    //! @brief Produce a copy with the given width, anchored at the origin.
+    //! @param width The desired width.
+
+    [[nodiscard]] constexpr BoundsValue withWidthFromOrigin(T const width) const {
+        return withSizeFromOrigin(width, size().y);
+    }
+
+    //! @brief Produce a copy with the given width, anchored at the centre.
+    //! @param width The desired width.
+
+    [[nodiscard]] constexpr BoundsValue withWidthFromCentre(T const width) const {
+        return withSizeFromCentre(width, size().y);
+    }
+
+    //! @brief Produce a copy with the given height, anchored at the origin.
+    //! @param height The desired height.
+
+    [[nodiscard]] constexpr BoundsValue withHeightFromOrigin(T const height) const {
+        return withSizeFromOrigin(size().x, height);
+    }
+
+    //! @brief Produce a copy with the given height, anchored at the centre.
+    //! @param height The desired height.
+
+    [[nodiscard]] constexpr BoundsValue withHeightFromCentre(T const height) const {
+        return withSizeFromCentre(size().x, height);
+    }
+
+public:
+    //! @brief Set the size of the bounds, anchored at the origin.
+    //! @param width The desired width.
+    //! @param height The desired height.
+
+    constexpr void setSizeFromOrigin(T const width, T const height) {
+        m_size.x = std::max(static_cast<T>(0), width);
+        m_size.y = std::max(static_cast<T>(0), height);
+        setPositionWithOrigin(m_origin.x, m_origin.y);
+    }
+
+    //! @brief Set the size of the bounds, anchored at the origin.
+    //! @param size The desired size.
+
+    constexpr void setSizeFromOrigin(SizeValue<T> const& size) {
+        setSizeFromOrigin(size.x, size.y);
+    }
+
+    //! @brief Set the size of the bounds, anchored at the centre point.
+    //! @param width The desired width.
+    //! @param height The desired height.
+
+    constexpr void setSizeFromCentre(T const width, T const height) {
+        m_size.x = std::max(static_cast<T>(0), width);
+        m_size.y = std::max(static_cast<T>(0), height);
+        setPositionWithCentre(m_centre.x, m_centre.y);
+    }
+
+    //! @brief Set the size of the bounds, anchored at the centre point.
+    //! @param size The desired size.
+
+    constexpr void setSizeFromCentre(SizeValue<T> const& size) {
+        setSizeFromCentre(size.x, size.y);
+    }
+
+public:
+    //! @brief Translate the position of the bounds.
+    //! @param deltaX The x component of the desired translation vector.
+    //! @param deltaY The y component of the desired translation vector.
+
+    constexpr void translate(T const deltaX, T const deltaY) {
+        setPositionWithOrigin(origin().x + deltaX, origin().y + deltaY);
+    }
+
+    //! @brief Set the x-coordinate of the origin point.
+    //! @param x The x-coordinate of the desired origin point.
+
+    constexpr void setOriginX(T const x) {
+        setPositionWithOrigin(x, origin().y);
+    }
+
+    //! @brief Set the y-coordinate of the origin point.
+    //! @param y The y-coordinate of the desired origin point.
+
+    constexpr void setOriginY(T const y) {
+        setPositionWithOrigin(origin().x, y);
+    }
+
+    //! @brief Set the x-coordinate of the centre point.
+    //! @param x The x-coordinate of the desired centre point.
+
+    constexpr void setCentreX(T const x) {
+        setPositionWithCentre(x, centre().y);
+    }
+
+    //! @brief Set the y-coordinate of the centre point.
+    //! @param y The y-coordinate of the desired centre point.
+
+    constexpr void setCentreY(T const y) {
+        setPositionWithCentre(centre().x, y);
+    }
+
+public:
+    //! @brief Set the position from the given origin point.
+    //! @param x The x-coordinate of the desired origin point.
+    //! @param y The y-coordinate of the desired origin point.
+
+    constexpr void setPositionWithOrigin(T const x, T const y) {
+        m_origin.x = x;
+        m_origin.y = y;
+        m_centre.x = x + half(m_size.x);
+        m_centre.y = y + half(m_size.y);
+    }
+
+    //! @brief Set the position from the given origin point.
+    //! @param xy The desired origin point.
+
+    constexpr void setPositionWithOrigin(PointValue<T> const& xy) {
+        setPositionWithOrigin(xy.x, xy.y);
+    }
+
+    //! @brief Set the position from the given centre point.
+    //! @param x The x-coordinate of the desired centre point.
+    //! @param y The y-coordinate of the desired centre point.
+
+    constexpr void setPositionWithCentre(T const x, T const y) {
+        m_centre.x = x;
+        m_centre.y = y;
+        m_origin.x = x - half(m_size.x);
+        m_origin.y = y - half(m_size.y);
+    }
+
+    //! @brief Set the position from the given centre point.
+    //! @param xy The desired centre point.
+
+    constexpr void setPositionWithCentre(PointValue<T> const& xy) {
+        setPositionWithCentre(xy.x, xy.y);
+    }
+
+public:
+    //! @brief Set the position from the given upper-left point (i.e., the origin).
+    //! @param x The x-coordinate of the desired point.
+    //! @param y The y-coordinate of the desired point.
+
+    constexpr void setPositionWithUpperLeft(T const x, T const y) {
+        setPositionWithOrigin(x, y);
+    }
+
+    //! @brief Set the position from the given upper-left point (i.e., the origin).
+    //! @param xy The desired point.
+
+    constexpr void setPositionWithUpperLeft(PointValue<T> const& xy) {
+        setPositionWithUpperLeft(xy.x, xy.y);
+    }
+
+    //! @brief Set the position from the given upper-right point.
+    //! @param x The x-coordinate of the desired point.
+    //! @param y The y-coordinate of the desired point.
+
+    constexpr void setPositionWithUpperRight(T const x, T const y) {
+        setPositionWithOrigin(x - size().x, y);
+    }
+
+    //! @brief Set the position from the given upper-right point.
+    //! @param xy The desired point.
+
+    constexpr void setPositionWithUpperRight(PointValue<T> const& xy) {
+        setPositionWithUpperRight(xy.x, xy.y);
+    }
+
+    //! @brief Set the position from the given lower-left point.
+    //! @param x The x-coordinate of the desired point.
+    //! @param y The y-coordinate of the desired point.
+
+    constexpr void setPositionWithLowerLeft(T const x, T const y) {
+        setPositionWithOrigin(x, y - size().y);
+    }
+
+    //! @brief Set the position from the given lower-left point.
+    //! @param xy The desired point.
+
+    constexpr void setPositionWithLowerLeft(PointValue<T> const& xy) {
+        setPositionWithLowerLeft(xy.x, xy.y);
+    }
+
+    //! @brief Set the position from the given lower-right point.
+    //! @param x The x-coordinate of the desired point.
+    //! @param y The y-coordinate of the desired point.
+
+    constexpr void setPositionWithLowerRight(T const x, T const y) {
+        setPositionWithOrigin(x - size().x, y - size().y);
+    }
+
+    //! @brief Set the position from the given lower-right point.
+    //! @param xy The desired point.
+
+    constexpr void setPositionWithLowerRight(PointValue<T> const& xy) {
+        setPositionWithLowerRight(xy.x, xy.y);
+    }
+
+public:
+    //! @brief Trim the given amount from each side equally.
+    //! @param amountToTrim The amount to be trimmed from each side.
+
+    constexpr BoundsValue& trim(T const amountToTrim) {
+        setSizeFromCentre(size() - amountToTrim * static_cast<T>(2));
+
+        return *this;
+    }
+
+    //! @brief Trim the given amount from the top side and return the trimmed area.
+    //! @param amountToTrim The amount to be trimmed from the top side.
+
+    constexpr BoundsValue trimFromTop(T const amountToTrim) {
+        setSizeFromOrigin(size().x, size().y - amountToTrim);
+        translate(static_cast<T>(0), amountToTrim);
+
+        return {origin().x, origin().y - amountToTrim, size().x, amountToTrim};
+    }
+
+    //! @brief Trim the given amount from the left side and return the trimmed area.
+    //! @param amountToTrim The amount to be trimmed from the left side.
+
+    constexpr BoundsValue trimFromLeft(T const amountToTrim) {
+        setSizeFromOrigin(size().x - amountToTrim, size().y);
+        translate(amountToTrim, static_cast<T>(0));
+
+        return {origin().x - amountToTrim, origin().y, amountToTrim, size().y};
+    }
+
+    //! @brief Trim the given amount from the right side and return the trimmed area.
+    //! @param amountToTrim The amount to be trimmed from the right side.
+
+    constexpr BoundsValue trimFromRight(T const amountToTrim) {
+        setSizeFromOrigin(size().x - amountToTrim, size().y);
+
+        return {origin().x + size().x, origin().y, amountToTrim, size().y};
+    }
+
+    //! @brief Trim the given amount from the bottom side and return the trimmed area.
+    //! @param amountToTrim The amount to be trimmed from the bottom side.
+
+    constexpr BoundsValue trimFromBottom(T const amountToTrim) {
+        setSizeFromOrigin(size().x, size().y - amountToTrim);
+
+        return {origin().x, origin().y + size().y, size().x, amountToTrim};
+    }
+
+private:
+    //! @brief Compute half of the given length, using integer division for integral types.
+    //! @param length The length to be halved.
+
+    static constexpr T half(T const length) {
+        return length / static_cast<T>(2);
+    }
+
+private:
+    SizeValue<T> m_size {};
+    PointValue<T> m_origin {};
+    PointValue<T> m_centre {};
+};
+
+static_assert(std::is_trivially_copyable_v<BoundsValue<float>> and std::is_standard_layout_v<BoundsValue<float>>);
+static_assert(sizeof(BoundsValue<float>) == 6 * sizeof(float));
+
+}
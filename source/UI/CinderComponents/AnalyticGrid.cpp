@@ -0,0 +1,46 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "AnalyticGrid.hpp"
+
+#include <algorithm>
+#include <UI/Rendering/ComponentCommands.hpp>
+
+namespace ds::ui {
+
+void AnalyticGrid::init() {
+    DS_PROFILE_SCOPE("AnalyticGrid", Rebuild);
+
+    auto const quad = ci::geom::Rect(ci::Rectf(0.0f, 0.0f, 1.0f, 1.0f));
+
+    DS_PROFILE_CREATION(Batch);
+    rules = cinder::gl::Batch::create(quad, getAnalyticGridProgram());
+}
+
+void AnalyticGrid::draw() {
+    draw(0.0f, 0.0f);
+}
+
+void AnalyticGrid::draw(Point<float> const& offset) {
+    draw(offset.x, offset.y);
+}
+
+void AnalyticGrid::draw(float const offsetX, float const offsetY) {
+    DS_PROFILE_SCOPE("AnalyticGrid", Draw);
+
+    // The grid's dimensions and spacing are uniforms, so a change to either requires no rebuild.
+    shouldRedraw = false;
+
+    commands::drawAnalyticGrid(getRenderer(), &rules, {offsetX, offsetY}, origin(), spacing(), dimensions(),
+                               getLinesGeometryHalfWidth(thickness));
+}
+
+void AnalyticGrid::adjustToLayout() {
+    /* The grid's lines are computed in its own space, so they are independent of the window's size */
+}
+
+void AnalyticGrid::setLineThickness(float const lineThickness) {
+    thickness = std::max(0.5f, lineThickness * 0.5f);
+}
+
+}
@@ -0,0 +1,59 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <UI/Components/Grid.hpp>
+#include <UI/Geometry/GridCoverage.hpp>
+#include <UI/CinderComponents/Programs.hpp>
+#include <UI/CinderComponents/CinderRenderer.hpp>
+#include <Profiling/Profiler.hpp>
+#include <cinder/gl/gl.h>
+
+namespace ds::ui {
+
+//! @class A grid whose lines are computed per pixel in a fragment shader rather than built from line geometry.
+//! @note The grid is drawn as one rectangle, so the cost of a draw is independent of the number of rows and columns,
+//! and no geometry shader is needed. Its interface matches that of `RuledGrid`, so either can be used.
+
+class AnalyticGrid: public Grid {
+public:
+    AnalyticGrid(int const rows, int const columns):
+            Grid(rows, columns) {
+        init();
+    }
+
+    AnalyticGrid(int const rows, int const columns, ds::ui::Size<float> const& cellSize):
+            Grid(rows, columns, cellSize) {
+        init();
+    }
+
+private:
+    void init();
+
+public:
+    void draw() override;
+    void draw(Point<float> const& offset) override;
+    void draw(float offsetX, float offsetY) override;
+    void adjustToLayout() override;
+
+public:
+    //! @brief Get the thickness of the grid's lines in pixels.
+
+    [[nodiscard]] inline float getLineThickness() const {
+        return thickness * 2.0f;
+    }
+
+    //! @brief Set the thickness of the grid's lines.
+    //! @param lineThickness The desired thickness in pixels.
+
+    void setLineThickness(float lineThickness);
+
+protected:
+    float thickness {2.0f};
+
+protected:
+    cinder::gl::BatchRef rules;
+};
+
+}
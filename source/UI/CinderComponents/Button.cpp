@@ -3,14 +3,19 @@
 
 #include "Button.hpp"
 
+#include <UI/Rendering/ComponentCommands.hpp>
+
 namespace ds::ui {
 
 void Button::init() {
+    DS_PROFILE_SCOPE("Button", Rebuild);
+
     auto const border = ci::Rectf(0.0f, 0.0f, size().w, size().h);
     auto const colour = ci::gl::ShaderDef().color();
     auto const shader = ci::gl::getStockShader(colour);
     auto const button = ci::geom::Rect(border);
 
+    DS_PROFILE_CREATION(Batch);
     buttonFill = cinder::gl::Batch::create(button, shader);
 }
 
@@ -23,27 +28,15 @@ void Button::draw(Point<float> const& offset) {
 }
 
 void Button::draw(float const offsetX, float const offsetY) {
+    DS_PROFILE_SCOPE("Button", Draw);
+
     if (shouldRedraw) {
         init();
     }
 
-    if (isButtonPressed() or isCursorHovering() or isBeingPressed()) {
-        cinder::gl::pushModelMatrix();
-        cinder::gl::translate(offsetX, offsetY);
-        cinder::gl::translate(origin().x, origin().y);
-
-        if (isButtonPressed()) {
-            cinder::gl::color(activeColour);
-            buttonFill->draw();
-        }
-
-        if (isCursorHovering()) {
-            cinder::gl::color(1.0f, 1.0f, 1.0f, isBeingPressed() ? 0.50f : 0.30f);
-            buttonFill->draw();
-        }
-
-        cinder::gl::popModelMatrix();
-    }
+    commands::drawButtonFills(getRenderer(), &buttonFill, {offsetX, offsetY}, origin(), toColour(activeColour), {
+            isButtonPressed(), isCursorHovering(), isBeingPressed()
+    });
 
     GridOutline::draw(offsetX, offsetY);
 }
@@ -31,10 +31,12 @@ public:
     }
 
     //! @brief Create a button that invokes the given function with its state.
+    //! @note The function is stored inline, so a callable object larger than `DefaultInlineCapacity` must first be
+    //! wrapped in a `std::function`.
     //! @param callback The function that should be invoked when the button's state changes.
     //! @param initialButtonState The button's initial state, which defaults to `false`.
 
-    explicit Button(std::function<void(bool)> callback, bool const initialButtonState = false):
+    explicit Button(ds::events::InlineFunction<void(bool)> callback, bool const initialButtonState = false):
             GridOutline(1, 2),
             ButtonState(std::move(callback), initialButtonState) {
         init();
@@ -49,6 +51,12 @@ public:
     void draw(float offsetX, float offsetY) override;
 
 public:
+    //! @brief Get the button's active colour.
+
+    [[nodiscard]] inline cinder::Color8u const& getActiveColour() const {
+        return activeColour;
+    }
+
     //! @brief Set the button's active colour.
     //! @param colour The desired active colour.
 
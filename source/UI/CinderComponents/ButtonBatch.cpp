@@ -0,0 +1,65 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "ButtonBatch.hpp"
+
+#include <algorithm>
+
+namespace ds::ui {
+
+ButtonBatch::ButtonBatch(Bounds<float> const& viewport):
+        instances(viewport) {
+    reserve(256);
+}
+
+void ButtonBatch::add(Button const& button, Point<float> const& offset) {
+    auto const& colour = button.getActiveColour();
+
+    instances.add(button, offset, {
+            button.isButtonPressed(),
+            button.isCursorHovering(),
+            button.isBeingPressed(),
+            {colour.r / 255.0f, colour.g / 255.0f, colour.b / 255.0f, 1.0f},
+            button.getLineThickness() * 0.5f
+    });
+}
+
+void ButtonBatch::draw() {
+    auto const& data = instances.getInstances();
+    drawnButtonCount = instances.getButtonCount();
+
+    if (not data.empty()) {
+        reserve(data.size());
+        vbo->bufferSubData(0, data.size() * sizeof(QuadInstance), data.data());
+        getRenderer().drawInstanced(&batch, static_cast<int>(data.size()));
+    }
+
+    instances.clear();
+}
+
+void ButtonBatch::reserve(std::size_t const instanceCount) {
+    if (instanceCount <= capacity and batch) {
+        return;
+    }
+
+    capacity = std::max(instanceCount, capacity * 2);
+
+    ci::geom::BufferLayout layout;
+    layout.append(ci::geom::Attrib::CUSTOM_0, 4, sizeof(QuadInstance), offsetof(QuadInstance, x), 1);
+    layout.append(ci::geom::Attrib::CUSTOM_1, 4, sizeof(QuadInstance), offsetof(QuadInstance, colour), 1);
+
+    auto const sizeInBytes = capacity * sizeof(QuadInstance);
+    vbo = ci::gl::Vbo::create(GL_ARRAY_BUFFER, sizeInBytes, nullptr, GL_DYNAMIC_DRAW);
+
+    auto const quad = ci::geom::Rect(ci::Rectf(0.0f, 0.0f, 1.0f, 1.0f));
+    auto const vboMesh = ci::gl::VboMesh::create(quad);
+    vboMesh->appendVbo(layout, vbo);
+
+    DS_PROFILE_CREATION(Batch);
+    batch = ci::gl::Batch::create(vboMesh, getQuadsProgram(), {
+            {ci::geom::Attrib::CUSTOM_0, "iRect"},
+            {ci::geom::Attrib::CUSTOM_1, "iColour"}
+    });
+}
+
+}
@@ -0,0 +1,63 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <cstddef>
+#include <cinder/gl/gl.h>
+#include <UI/CinderComponents/Programs.hpp>
+#include <UI/Geometry/ButtonInstances.hpp>
+#include <UI/CinderComponents/Button.hpp>
+
+namespace ds::ui {
+
+//! @class A renderer that draws any number of buttons with a single instanced draw call.
+//! @note Add each visible button once per frame in place of calling its `draw` method, then call `draw` once.
+//! The instance buffer persists between frames and grows only when the number of instances exceeds its capacity.
+
+class ButtonBatch {
+public:
+    //! @brief Create an empty button batch.
+    //! @param viewport The visible region of the screen. Buttons that lie entirely outside it are skipped.
+
+    explicit ButtonBatch(Bounds<float> const& viewport);
+
+public:
+    //! @brief Add the given button to the current frame.
+    //! @param button The button to be drawn.
+    //! @param offset The offset that the button should be drawn with.
+
+    void add(Button const& button, Point<float> const& offset = {0.0f, 0.0f});
+
+    //! @brief Draw every button added since the previous draw and empty the batch.
+
+    void draw();
+
+    //! @brief Set the visible region of the screen.
+    //! @param viewport The desired viewport.
+
+    inline void setViewport(Bounds<float> const& viewport) {
+        instances.setViewport(viewport);
+    }
+
+public:
+    //! @brief Get the number of buttons drawn by the most recent draw.
+
+    [[nodiscard]] inline std::size_t getDrawnButtonCount() const {
+        return drawnButtonCount;
+    }
+
+private:
+    void reserve(std::size_t instanceCount);
+
+private:
+    ButtonInstances instances;
+    std::size_t capacity {0};
+    std::size_t drawnButtonCount {0};
+
+private:
+    cinder::gl::VboRef vbo;
+    cinder::gl::BatchRef batch;
+};
+
+}
@@ -0,0 +1,81 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "CinderRenderer.hpp"
+
+namespace ds::ui {
+
+namespace {
+
+inline cinder::gl::BatchRef const& getBatch(RenderResource const resource) {
+    return *static_cast<cinder::gl::BatchRef const*>(resource);
+}
+
+inline cinder::gl::TextureRef const& getTexture(RenderResource const resource) {
+    return *static_cast<cinder::gl::TextureRef const*>(resource);
+}
+
+}
+
+void CinderRenderer::pushTransform() {
+    cinder::gl::pushModelMatrix();
+}
+
+void CinderRenderer::popTransform() {
+    cinder::gl::popModelMatrix();
+}
+
+void CinderRenderer::translate(float const x, float const y) {
+    cinder::gl::translate(x, y);
+}
+
+void CinderRenderer::scale(float const x, float const y) {
+    cinder::gl::scale(x, y);
+}
+
+void CinderRenderer::colour(Colour const& colour) {
+    cinder::gl::color(colour.r, colour.g, colour.b, colour.a);
+}
+
+void CinderRenderer::uniform(RenderResource const batch, char const* const name, UniformValue const& value) {
+    auto const& program = getBatch(batch)->getGlslProg();
+    auto const& f = value.floats;
+    auto const& i = value.ints;
+
+    if (value.type == UniformValue::Type::Float) {
+        switch (value.size) {
+            case 1: return program->uniform(name, f[0]);
+            case 2: return program->uniform(name, ci::vec2(f[0], f[1]));
+            case 4: return program->uniform(name, ci::vec4(f[0], f[1], f[2], f[3]));
+            default: return;
+        }
+    } else {
+        switch (value.size) {
+            case 1: return program->uniform(name, i[0]);
+            case 2: return program->uniform(name, ci::ivec2(i[0], i[1]));
+            default: return;
+        }
+    }
+}
+
+void CinderRenderer::drawBatch(RenderResource const batch,
+                               int const first,
+                               int const count,
+                               RenderResource const texture) {
+    if (texture != nullptr) {
+        cinder::gl::ScopedTextureBind const scopedTexture(getTexture(texture));
+        getBatch(batch)->draw(first, count);
+    } else {
+        getBatch(batch)->draw(first, count);
+    }
+}
+
+void CinderRenderer::drawInstanced(RenderResource const batch, int const instanceCount) {
+    getBatch(batch)->drawInstanced(instanceCount);
+}
+
+void CinderRenderer::drawTexture(RenderResource const texture) {
+    cinder::gl::draw(getTexture(texture));
+}
+
+}
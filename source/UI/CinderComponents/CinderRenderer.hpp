@@ -0,0 +1,53 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <cinder/gl/gl.h>
+#include <UI/Rendering/Renderer.hpp>
+
+namespace ds::ui {
+
+//! @class A renderer that draws through `cinder::gl`.
+//! @note Resources are the addresses of `cinder::gl::BatchRef` and `cinder::gl::TextureRef` objects.
+
+class CinderRenderer: public Renderer {
+public:
+    void pushTransform() override;
+    void popTransform() override;
+    void translate(float x, float y) override;
+    void scale(float x, float y) override;
+    void colour(Colour const& colour) override;
+    void uniform(RenderResource batch, char const* name, UniformValue const& value) override;
+    void drawBatch(RenderResource batch, int first, int count, RenderResource texture) override;
+    void drawInstanced(RenderResource batch, int instanceCount) override;
+    void drawTexture(RenderResource texture) override;
+};
+
+//! @brief Get the installed renderer, or the Cinder renderer if no renderer is installed.
+
+inline Renderer& getRenderer() {
+    static CinderRenderer cinderRenderer;
+
+    if (auto* const renderer = Renderer::getInstalled()) {
+        return *renderer;
+    }
+
+    return cinderRenderer;
+}
+
+//! @brief Convert the given Cinder colour to a colour.
+//! @param colour The colour to be converted.
+
+inline Colour toColour(cinder::Color8u const& colour) {
+    return {colour.r / 255.0f, colour.g / 255.0f, colour.b / 255.0f, 1.0f};
+}
+
+//! @brief Convert the given Cinder colour to a colour.
+//! @param colour The colour to be converted.
+
+inline Colour toColour(cinder::ColorA8u const& colour) {
+    return {colour.r / 255.0f, colour.g / 255.0f, colour.b / 255.0f, colour.a / 255.0f};
+}
+
+}
@@ -3,45 +3,19 @@
 
 #include "DotGrid.hpp"
 
+#include <UI/Rendering/ComponentCommands.hpp>
+
 namespace ds::ui {
 
 void DotGrid::init() {
-    auto const cells = dimensions().x * dimensions().y;
-
-    struct Dot {
-        ci::vec4 position;
-        ci::vec4 color;
-    };
-
-    ci::geom::BufferLayout layout;
-    layout.append(ci::geom::Attrib::COLOR, 4, sizeof(Dot), offsetof(Dot, color), 1);
-    layout.append(ci::geom::Attrib::CUSTOM_0, 4, sizeof(Dot), offsetof(Dot, position), 1);
+    DS_PROFILE_SCOPE("DotGrid", Rebuild);
 
-    std::vector<Dot> dots;
-    for (auto row = 0; row < dimensions().y; ++row) {
-        for (auto col = 0; col < dimensions().x; ++col) {
-            auto& dot = dots.emplace_back();
-            dot.color = {ci::vec3(1.0f), 1.0f};
-            dot.position.w = dotRadius;
-            dot.position.x = static_cast<float>(col);
-            dot.position.y = static_cast<float>(row);
-        }
-    }
-
-    auto const sizeInBytes = cells * static_cast<int>(sizeof(Dot));
-    auto const vbo = ci::gl::Vbo::create(GL_ARRAY_BUFFER, sizeInBytes, dots.data(), GL_STATIC_DRAW);
+    // Each instance derives its cell from its instance index, so the batch does not depend on the grid's
+    // dimensions and is created only once.
     auto const circles = ci::geom::Circle().center(ci::vec2(0)).radius(1.0f).subdivisions(32);
-    auto const vboMesh = ci::gl::VboMesh::create(circles);
-    vboMesh->appendVbo(layout, vbo);
-
-    using namespace ds::ui::shader;
-    auto const source = ci::gl::GlslProg::Format().vertex(GridCellsVertex()).fragment(GridCellsFragment());
-    auto const shader = ci::gl::GlslProg::create(source);
-    shader->uniform("gridSpacing", ci::vec2(spacing().x, spacing().y));
 
-    batch = ci::gl::Batch::create(vboMesh, shader, {
-            {ci::geom::Attrib::CUSTOM_0, "iPositionAndRadius"}
-    });
+    DS_PROFILE_CREATION(Batch);
+    batch = ci::gl::Batch::create(circles, getGridCellsProgram());
 }
 
 void DotGrid::draw() {
@@ -53,19 +27,17 @@ void DotGrid::draw(Point<float> const& offset) {
 }
 
 void DotGrid::draw(float const offsetX, float const offsetY) {
-    if (shouldRedraw) {
-        shouldRedraw = false;
-        init();
-    }
+    DS_PROFILE_SCOPE("DotGrid", Draw);
 
-    cinder::gl::pushModelMatrix();
-    cinder::gl::translate(offsetX, offsetY);
-    cinder::gl::translate(origin().x, origin().y);
-    cinder::gl::color(1.0f, 1.0f, 1.0f);
+    shouldRedraw = false;
 
-    batch->drawInstanced(dimensions().x * dimensions().y);
+    auto const position = Point<float>(offsetX + origin().x, offsetY + origin().y);
+    auto const window = ci::app::getWindowSize();
+    auto const viewport = hasViewport ? visibleRegion : Bounds<float>(0.0f, 0.0f, static_cast<float>(window.x),
+                                                                      static_cast<float>(window.y));
 
-    cinder::gl::popModelMatrix();
+    auto const cells = getVisibleCells(position, spacing(), dimensions(), viewport, dotRadius);
+    commands::drawDotGrid(getRenderer(), &batch, position, spacing(), cells, dotRadius);
 }
 
-}
\ No newline at end of file
+}
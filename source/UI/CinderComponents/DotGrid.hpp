@@ -4,12 +4,19 @@
 #pragma once
 
 #include <UI/Components/Grid.hpp>
-#include <Shaders/GridCells.hpp>
+#include <UI/Geometry/GridCulling.hpp>
+#include <UI/CinderComponents/Programs.hpp>
+#include <UI/CinderComponents/CinderRenderer.hpp>
+#include <Profiling/Profiler.hpp>
+#include <cinder/app/App.h>
 #include <cinder/gl/gl.h>
-#include <vector>
 
 namespace ds::ui {
 
+//! @class A grid that draws a dot at the centre of each cell.
+//! @note Only the cells that overlap the viewport are drawn, so the cost of a draw depends on the visible area of
+//! the grid rather than its dimensions.
+
 class DotGrid: public Grid {
 public:
     DotGrid(int const rows, int const columns): Grid(rows, columns) {
@@ -29,9 +36,22 @@ public:
     void draw(Point<float> const& offset) override;
     void draw(float offsetX, float offsetY) override;
 
+public:
+    //! @brief Set the visible region, in the space of the draw offset, outside of which dots are not drawn.
+    //! @param viewport The desired viewport. The window's bounds are used until a viewport is set.
+
+    inline void setViewport(Bounds<float> const& viewport) {
+        visibleRegion = viewport;
+        hasViewport = true;
+    }
+
 private:
     float dotRadius {3.0f};
 
+private:
+    bool hasViewport {false};
+    Bounds<float> visibleRegion {};
+
 private:
     cinder::gl::BatchRef batch;
 };
@@ -0,0 +1,161 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "GlyphAtlas.hpp"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <cinder/Text.h>
+#include <cinder/ip/Fill.h>
+
+namespace ds::ui {
+
+namespace {
+
+constexpr int atlasWidth = 512;
+constexpr char firstPrintable = ' ';
+constexpr char lastPrintable = '~';
+
+inline cinder::TextBox getGlyphTextBox(cinder::Font const& font, char const character) {
+    auto box = cinder::TextBox();
+    box.font(font)
+       .size(cinder::TextBox::GROW, cinder::TextBox::GROW)
+       .color(cinder::Color::white())
+       .premultiplied(false)
+       .text(std::string(1, character));
+
+    return box;
+}
+
+}
+
+std::shared_ptr<GlyphAtlas const> GlyphAtlas::get(cinder::Font const& font) {
+    static std::unordered_map<std::string, std::shared_ptr<GlyphAtlas const>> atlases;
+
+    auto const key = font.getName() + '@' + std::to_string(font.getSize());
+    auto& atlas = atlases[key];
+    if (not atlas) {
+        atlas = std::shared_ptr<GlyphAtlas const>(new GlyphAtlas(font));
+    }
+
+    return atlas;
+}
+
+GlyphAtlas::GlyphAtlas(cinder::Font const& font):
+        metrics(font.getAscent() + font.getDescent()) {
+    struct Placement {
+        char character;
+        cinder::Surface8u surface;
+        cinder::ivec2 position;
+        float advance;
+    };
+
+    // Rasterise each glyph and place it on a shelf, starting a new shelf whenever the current one is full.
+
+    std::vector<Placement> placements;
+    placements.reserve(lastPrintable - firstPrintable + 1);
+    auto shelf = cinder::ivec2(0, 0);
+    auto shelfHeight = 0;
+
+    for (auto character = firstPrintable; character <= lastPrintable; ++character) {
+        auto box = getGlyphTextBox(font, character);
+        auto const advance = box.measure().x;
+        auto surface = box.render();
+
+        if (shelf.x + surface.getWidth() > atlasWidth) {
+            shelf = {0, shelf.y + shelfHeight + 1};
+            shelfHeight = 0;
+        }
+
+        placements.push_back({character, surface, shelf, advance});
+        shelf.x = shelf.x + surface.getWidth() + 1;
+        shelfHeight = std::max(shelfHeight, surface.getHeight());
+    }
+
+    auto const atlasHeight = shelf.y + shelfHeight;
+    auto atlas = cinder::Surface8u(atlasWidth, atlasHeight, true);
+    cinder::ip::fill(&atlas, cinder::ColorA8u(0, 0, 0, 0));
+
+    for (auto const& placement: placements) {
+        auto const w = placement.surface.getWidth();
+        auto const h = placement.surface.getHeight();
+        atlas.copyFrom(placement.surface, placement.surface.getBounds(), placement.position);
+
+        metrics.setGlyph(placement.character, {
+                placement.advance, 0.0f, 0.0f, static_cast<float>(w), static_cast<float>(h),
+                static_cast<float>(placement.position.x) / atlasWidth,
+                static_cast<float>(placement.position.y) / static_cast<float>(atlasHeight),
+                static_cast<float>(placement.position.x + w) / atlasWidth,
+                static_cast<float>(placement.position.y + h) / static_cast<float>(atlasHeight)
+        });
+    }
+
+    DS_PROFILE_CREATION(Texture);
+    texture = cinder::gl::Texture::create(atlas, cinder::gl::Texture::Format().loadTopDown());
+}
+
+GlyphText::GlyphText(cinder::Font const& font):
+        atlas(GlyphAtlas::get(font)),
+        layout(atlas->getMetrics()) {
+    reserve(64);
+}
+
+void GlyphText::setText(std::string_view const text, float const boxWidth, TextAlignment const alignment) {
+    DS_PROFILE_SCOPE("GlyphText", Rebuild);
+
+    if (layout.setText(text, boxWidth, alignment)) {
+        upload();
+    }
+}
+
+void GlyphText::setFont(cinder::Font const& font) {
+    auto const fontAtlas = GlyphAtlas::get(font);
+    if (fontAtlas != atlas) {
+        atlas = fontAtlas;
+        layout.setMetrics(atlas->getMetrics());
+        upload();
+    }
+}
+
+void GlyphText::draw() const {
+    auto const vertexCount = layout.getVertices().size();
+    if (vertexCount > 0) {
+        getRenderer().drawBatch(&batch, 0, static_cast<int>(vertexCount), &atlas->getTexture());
+    }
+}
+
+void GlyphText::upload() {
+    auto const& vertices = layout.getVertices();
+
+    if (vertices.size() > capacity) {
+        reserve(vertices.size());
+        vbo->bufferSubData(0, vertices.size() * sizeof(GlyphVertex), vertices.data());
+    } else {
+        auto const range = layout.getDirtyRange();
+        if (range.count > 0) {
+            auto const offset = range.first * sizeof(GlyphVertex);
+            vbo->bufferSubData(offset, range.count * sizeof(GlyphVertex), vertices.data() + range.first);
+        }
+    }
+}
+
+void GlyphText::reserve(std::size_t const vertexCount) {
+    capacity = std::max(vertexCount, capacity * 2);
+
+    ci::geom::BufferLayout bufferLayout;
+    bufferLayout.append(ci::geom::Attrib::POSITION, 2, sizeof(GlyphVertex), offsetof(GlyphVertex, x));
+    bufferLayout.append(ci::geom::Attrib::TEX_COORD_0, 2, sizeof(GlyphVertex), offsetof(GlyphVertex, u));
+
+    vbo = ci::gl::Vbo::create(GL_ARRAY_BUFFER, capacity * sizeof(GlyphVertex), nullptr, GL_DYNAMIC_DRAW);
+
+    auto const vertexTotal = static_cast<uint32_t>(capacity);
+    auto const mesh = ci::gl::VboMesh::create(vertexTotal, GL_TRIANGLES, {{bufferLayout, vbo}});
+    auto const shader = ci::gl::getStockShader(ci::gl::ShaderDef().texture().color());
+
+    DS_PROFILE_CREATION(Batch);
+    batch = ci::gl::Batch::create(mesh, shader);
+}
+
+}
@@ -0,0 +1,107 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <memory>
+#include <cinder/Font.h>
+#include <cinder/gl/gl.h>
+#include <UI/Geometry/TextLayout.hpp>
+#include <UI/CinderComponents/CinderRenderer.hpp>
+#include <Profiling/Profiler.hpp>
+
+namespace ds::ui {
+
+//! @class A texture holding the printable ASCII glyphs of one font at one size, with their metrics.
+//! @note Atlases are shared by every component that uses the same font, so each font is rasterised only once.
+
+class GlyphAtlas {
+public:
+    //! @brief Get the atlas of the given font, rasterising it if no component has done so already.
+    //! @param font The font of interest.
+
+    static std::shared_ptr<GlyphAtlas const> get(cinder::Font const& font);
+
+public:
+    //! @brief Get the metrics of the atlas's glyphs.
+
+    [[nodiscard]] inline GlyphMetrics const& getMetrics() const {
+        return metrics;
+    }
+
+    //! @brief Get the texture holding the atlas's glyphs.
+
+    [[nodiscard]] inline cinder::gl::TextureRef const& getTexture() const {
+        return texture;
+    }
+
+private:
+    explicit GlyphAtlas(cinder::Font const& font);
+
+private:
+    GlyphMetrics metrics;
+    cinder::gl::TextureRef texture;
+};
+
+//! @class A line of text drawn as quads that index into a shared glyph atlas.
+//! @note Changing the text rewrites only the vertices of the glyphs that moved or changed.
+
+class GlyphText {
+public:
+    //! @brief Create an empty line of text.
+    //! @param font The font that the text should be drawn with.
+
+    explicit GlyphText(cinder::Font const& font);
+
+public:
+    //! @brief Set the text and lay it out within a box of the given width.
+    //! @param text The desired text.
+    //! @param boxWidth The width of the box that the text is aligned within.
+    //! @param alignment The horizontal alignment of the text within its box.
+
+    void setText(std::string_view text, float boxWidth, TextAlignment alignment);
+
+    //! @brief Set the font that the text should be drawn with.
+    //! @param font The desired font.
+
+    void setFont(cinder::Font const& font);
+
+    //! @brief Draw the text with the current colour, with the upper-left corner of its box at the origin.
+
+    void draw() const;
+
+public:
+    //! @brief Compute the width of the given text in pixels when drawn with the current font.
+    //! @param text The text to be measured.
+
+    [[nodiscard]] inline float measure(std::string_view const text) const {
+        return atlas->getMetrics().measure(text);
+    }
+
+    //! @brief Get the width of the current text in pixels.
+
+    [[nodiscard]] inline float getTextWidth() const {
+        return layout.getTextWidth();
+    }
+
+    //! @brief Get the height of the current text in pixels.
+
+    [[nodiscard]] inline float getTextHeight() const {
+        return layout.getTextHeight();
+    }
+
+private:
+    void upload();
+    void reserve(std::size_t vertexCount);
+
+private:
+    std::shared_ptr<GlyphAtlas const> atlas;
+    TextLayout layout;
+    std::size_t capacity {0};
+
+private:
+    cinder::gl::VboRef vbo;
+    cinder::gl::BatchRef batch;
+};
+
+}
@@ -6,33 +6,30 @@
 namespace ds::ui {
 
 void GridOutline::init() {
-    auto const grid = ci::gl::VertBatch::create(GL_LINES);
+    DS_PROFILE_SCOPE("GridOutline", Rebuild);
 
-    for (int const& row: {0, dimensions().y}) {
-        auto const x = static_cast<float>(size().x);
-        auto const y = static_cast<float>(row) * spacing().h;
-        grid->vertex(0, y, 0);
-        grid->vertex(x, y, 0);
-    }
+    static constexpr auto vertices = GridLineBuffer::getOutlineVertices();
+    auto const sizeInBytes = vertices.size() * sizeof(GridLineVertex);
+    lineVertices = ci::gl::Vbo::create(GL_ARRAY_BUFFER, sizeInBytes, vertices.data(), GL_STATIC_DRAW);
 
-    for (int const& col: {0, dimensions().x}) {
-        auto const x = static_cast<float>(col) * spacing().w;
-        auto const y = static_cast<float>(size().y);
-        grid->vertex(x, 0, 0);
-        grid->vertex(x, y, 0);
-    }
+    ci::geom::BufferLayout layout;
+    layout.append(ci::geom::Attrib::CUSTOM_0, 4, sizeof(GridLineVertex), 0);
 
-    auto const program = cinder::gl::GlslProg::Format().version(150)
-                                                       .vertex(ds::ui::shader::LinesVertex())
-                                                       .fragment(ds::ui::shader::LinesFragment())
-                                                       .geometry(ds::ui::shader::LinesGeometry());
+    auto const vertexCount = static_cast<uint32_t>(vertices.size());
+    auto const mesh = ci::gl::VboMesh::create(vertexCount, GL_LINES, {{layout, lineVertices}});
 
-    auto const shader = cinder::gl::GlslProg::create(program);
+    DS_PROFILE_CREATION(Batch);
+    rules = cinder::gl::Batch::create(mesh, getGridLinesProgram(), {
+            {ci::geom::Attrib::CUSTOM_0, "iGridLine"}
+    });
+}
 
-    shader->uniform("LineThickness", thickness);
-    shader->uniform("ViewportScale", ci::vec2(cinder::app::getWindowSize()));
+void GridOutline::updateRules() {
+    /* The outline's vertices are independent of its dimensions and spacing */
+}
 
-    rules = cinder::gl::Batch::create(*grid, shader);
+void GridOutline::drawRules() {
+    commands::drawOutlineRules(getRenderer(), &rules);
 }
 
 void GridOutline::draw() {
@@ -44,12 +41,9 @@ void GridOutline::draw(Point<float> const& offset) {
 }
 
 void GridOutline::draw(float const offsetX, float const offsetY) {
-    if (shouldRedraw) {
-        shouldRedraw = false;
-        init();
-    }
+    DS_PROFILE_SCOPE("GridOutline", Draw);
 
     RuledGrid::draw(offsetX, offsetY);
 }
 
-}
\ No newline at end of file
+}
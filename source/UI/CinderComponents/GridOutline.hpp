@@ -24,6 +24,10 @@ public:
     void draw(Point<float> const& offset) override;
     void draw(float offsetX, float offsetY) override;
 
+protected:
+    void updateRules() override;
+    void drawRules() override;
+
 private:
     void init();
 };
@@ -6,23 +6,21 @@
 namespace ds::ui {
 
 void Label::init() {
-    textBox.size(static_cast<int>(size().w), ci::TextBox::GROW)
-           .alignment(ci::TextBox::LEFT)
-           .color(ci::Color::white())
-           .premultiplied(false);
+    DS_PROFILE_SCOPE("Label", Rebuild);
 
     auto const colour = cinder::gl::ShaderDef().color();
     auto const shader = cinder::gl::getStockShader(colour);
     auto const border = ci::Rectf(0.0f, 0.0f, size().w, size().h);
     auto const geometry = ci::geom::Rect(border);
 
+    DS_PROFILE_CREATION(Batch);
     background = cinder::gl::Batch::create(geometry, shader);
 
     didUpdateLabel();
 }
 
 void Label::init(cinder::Font const& labelFont) {
-    textBox.font(labelFont);
+    glyphs.setFont(labelFont);
     init();
 }
 
@@ -35,20 +33,23 @@ void Label::draw(Point<float> const& offset) {
 }
 
 void Label::draw(float const offsetX, float const offsetY) {
+    DS_PROFILE_SCOPE("Label", Draw);
+
     if (shouldRedraw) {
         init();
     }
 
-    cinder::gl::pushModelMatrix();
-    cinder::gl::translate(offsetX, offsetY);
-    cinder::gl::translate(origin().x, origin().y);
-    cinder::gl::color(backgroundColour);
-    background->draw();
+    auto& renderer = getRenderer();
+    renderer.pushTransform();
+    renderer.translate(offsetX, offsetY);
+    renderer.translate(origin().x, origin().y);
+    renderer.colour(toColour(backgroundColour));
+    renderer.drawBatch(&background);
 
-    cinder::gl::translate(0.0f, 0.5f * (size().h - static_cast<float>(texture->getHeight())));
-    cinder::gl::color(1.0f, 1.0f, 1.0f);
-    cinder::gl::draw(texture);
-    cinder::gl::popModelMatrix();
+    renderer.translate(0.0f, 0.5f * (size().h - glyphs.getTextHeight()));
+    renderer.colour(toColour(labelTextColour));
+    glyphs.draw();
+    renderer.popTransform();
 
     if (shouldDrawOutline) {
         GridOutline::draw(offsetX, offsetY);
@@ -56,16 +57,12 @@ void Label::draw(float const offsetX, float const offsetY) {
 }
 
 void Label::adjustToLayout() {
-    textBox.size(static_cast<int>(size().w), ci::TextBox::GROW);
+    didUpdateLabel();
     GridOutline::adjustToLayout();
 }
 
 int Label::getColumnSpanForText(std::string_view labelText) {
-    auto const& priorSize = textBox.getSize();
-    auto const columnSpan = static_cast<float>(textBox.size(0, 0).text(std::string(labelText)).measure().x) /
-                            static_cast<float>(spacing().x);
-
-    textBox.size(priorSize).text(std::string(text));
+    auto const columnSpan = glyphs.measure(labelText) / spacing().x;
 
     return static_cast<int>(std::ceil(columnSpan));
 }
@@ -76,7 +73,7 @@ void Label::setText(std::string_view newLabelText) {
 }
 
 void Label::setFont(cinder::Font const& newFont) {
-    textBox.font(newFont);
+    glyphs.setFont(newFont);
     didUpdateLabel();
 }
 
@@ -86,7 +83,6 @@ void Label::setTextColour(uint8_t red, uint8_t green, uint8_t blue, uint8_t alph
 
 void Label::setTextColour(cinder::ColorA8u const& newTextColour) {
     labelTextColour = newTextColour;
-    didUpdateLabel();
 }
 
 void Label::setBackgroundColour(uint8_t const red, uint8_t const green, uint8_t const blue, uint8_t const alpha) {
@@ -102,9 +98,7 @@ void Label::setShouldDrawBorder(bool const shouldDrawBorder) {
 }
 
 void Label::didUpdateLabel() {
-    textBox.color(labelTextColour);
-    textBox.setText(std::string(text));
-    texture = cinder::gl::Texture::create(textBox.render());
+    glyphs.setText(text, size().w, TextAlignment::Left);
 }
 
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include <string_view>
 #include <cinder/Font.h>
 #include <cinder/gl/gl.h>
+#include <UI/CinderComponents/GlyphAtlas.hpp>
 #include <UI/CinderComponents/GridOutline.hpp>
 
 namespace ds::ui {
@@ -25,6 +26,7 @@ public:
 
     Label(int const rows, int const columns, std::string_view labelText, cinder::Font const& labelFont):
             GridOutline(rows, columns),
+            glyphs(labelFont),
             backgroundColour(cinder::ColorA8u(0, 0, 0, 1)),
             labelTextColour(cinder::Color::white()),
             text(labelText) {
@@ -57,8 +59,7 @@ private:
     int getColumnSpanForText(std::string_view labelText);
 
 private:
-    ci::TextBox textBox;
-    ci::gl::TextureRef texture;
+    GlyphText glyphs;
     ci::gl::BatchRef background;
 
 private:
@@ -3,12 +3,12 @@
 
 #pragma once
 
-#include <string>
-#include <iomanip>
-#include <sstream>
+#include <string_view>
 #include <cinder/Font.h>
 #include <cinder/gl/gl.h>
+#include <UI/Constructs/NumberFormat.hpp>
 #include <UI/Constructs/ScrollableValue.hpp>
+#include <UI/CinderComponents/GlyphAtlas.hpp>
 #include <UI/CinderComponents/GridOutline.hpp>
 
 namespace ds::ui {
@@ -25,29 +25,29 @@ public:
 
     NumberLabel(T const minimumValue, T const initialValue, T const maximumValue, cinder::Font const& labelFont):
             ds::ui::GridOutline(1, 3),
-            ds::ui::ScrollableValue<T>(minimumValue, initialValue, maximumValue) {
+            ds::ui::ScrollableValue<T>(minimumValue, initialValue, maximumValue),
+            glyphs(labelFont) {
         init(labelFont);
     }
 
 private:
     void init() {
-        textBox.size(size().w, ci::TextBox::GROW)
-               .alignment(ci::TextBox::CENTER)
-               .color(ci::Color::white())
-               .premultiplied(false);
+        DS_PROFILE_SCOPE("NumberLabel", Rebuild);
 
         auto const colour = cinder::gl::ShaderDef().color();
         auto const shader = cinder::gl::getStockShader(colour);
         auto const border = ci::Rectf(0.0f, 0.0f, size().w, size().h);
         auto const geometry = ci::geom::Rect(border);
 
+        DS_PROFILE_CREATION(Batch);
         hoverBatch = cinder::gl::Batch::create(geometry, shader);
 
-        didUpdateScrollableValue();
+        valueFormat.format(ScrollableValue<T>::getValue());
+        glyphs.setText(valueFormat.view(), size().w, TextAlignment::Centre);
     }
 
     void init(cinder::Font const& labelFont) {
-        textBox.font(labelFont);
+        glyphs.setFont(labelFont);
         init();
     }
 
@@ -61,23 +61,28 @@ public:
     }
 
     void draw(float const offsetX, float const offsetY) override {
+        DS_PROFILE_SCOPE("NumberLabel", Draw);
+
         if (shouldRedraw) {
             init();
         }
 
-        cinder::gl::pushModelMatrix();
-        cinder::gl::translate(offsetX, offsetY);
-        cinder::gl::translate(origin().x, origin().y);
+        ScrollableValue<T>::flushParameterBinding();
+
+        auto& renderer = getRenderer();
+        renderer.pushTransform();
+        renderer.translate(offsetX, offsetY);
+        renderer.translate(origin().x, origin().y);
 
         if (ScrollableValue<T>::isCursorHovering()) {
-            cinder::gl::color(0.5f, 0.5f, 0.5f);
-            hoverBatch->draw();
+            renderer.colour({0.5f, 0.5f, 0.5f});
+            renderer.drawBatch(&hoverBatch);
         }
 
-        cinder::gl::translate(0.0f, 0.5f * (size().h - static_cast<float>(texture->getHeight())));
-        cinder::gl::color(1.0f, 1.0f, 1.0f);
-        cinder::gl::draw(texture);
-        cinder::gl::popModelMatrix();
+        renderer.translate(0.0f, 0.5f * (size().h - glyphs.getTextHeight()));
+        renderer.colour({1.0f, 1.0f, 1.0f});
+        glyphs.draw();
+        renderer.popTransform();
 
         ds::ui::GridOutline::draw(offsetX, offsetY);
     }
@@ -98,14 +103,29 @@ public:
         return *this;
     }
 
+    //! @brief Set the number of digits displayed after the decimal point of a floating-point value.
+    //! @param precision The desired number of digits.
+
+    NumberLabel& setPrecision(int const precision) {
+        valueFormat.setPrecision(precision);
+        didUpdateScrollableValue();
+        return *this;
+    }
+
+    //! @brief Set the units displayed after the value.
+    //! @param units The desired units.
+
+    NumberLabel& setUnits(std::string_view const units) {
+        valueFormat.setUnits(units);
+        didUpdateScrollableValue();
+        return *this;
+    }
+
 protected:
     void didUpdateScrollableValue() override {
-        valueString.str("");
-        valueString << std::fixed << std::setprecision(2);
-        valueString << ScrollableValue<T>::getValue();
-
-        textBox.setText(valueString.str());
-        texture = ci::gl::Texture::create(textBox.render());
+        if (valueFormat.format(ScrollableValue<T>::getValue())) {
+            glyphs.setText(valueFormat.view(), size().w, TextAlignment::Centre);
+        }
     }
 
 protected:
@@ -114,12 +134,11 @@ protected:
     }
 
 protected:
-    ci::TextBox textBox;
+    GlyphText glyphs;
     ci::gl::BatchRef hoverBatch;
-    ci::gl::TextureRef texture;
 
 protected:
-    std::stringstream valueString;
+    NumberFormat<T> valueFormat {2};
 };
 
 }
\ No newline at end of file
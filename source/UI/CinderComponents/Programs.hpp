@@ -0,0 +1,77 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <string>
+#include <cinder/gl/gl.h>
+#include <Shaders/Lines.hpp>
+#include <Shaders/Quads.hpp>
+#include <Shaders/GridCells.hpp>
+#include <Shaders/AnalyticGrid.hpp>
+#include <Shaders/ProgramCache.hpp>
+#include <Profiling/Profiler.hpp>
+
+namespace ds::ui {
+
+//! @brief Get the process-wide cache of linked shader programs.
+
+inline shader::ProgramCache<cinder::gl::GlslProgRef>& getProgramCache() {
+    static shader::ProgramCache<cinder::gl::GlslProgRef> cache;
+    return cache;
+}
+
+//! @brief Get the linked program with the given sources, compiling it only if no component has done so already.
+//! @param source The sources and format of the desired program.
+
+inline cinder::gl::GlslProgRef getProgram(shader::ProgramSource const& source) {
+    return getProgramCache().get(source, [](shader::ProgramSource const& program) {
+        auto format = cinder::gl::GlslProg::Format().version(program.version)
+                                                     .vertex(std::string(program.vertex))
+                                                     .fragment(std::string(program.fragment));
+
+        if (not program.geometry.empty()) {
+            format.geometry(std::string(program.geometry));
+        }
+
+        DS_PROFILE_CREATION(Program);
+        return cinder::gl::GlslProg::create(format);
+    });
+}
+
+//! @brief Get the program that draws thick grid lines from `GridLineVertex` data.
+//! @note The program's `LineThickness`, `ViewportScale`, `gridSpacing` and `gridDimensions` uniforms are shared,
+//! so they must be set before each draw.
+
+inline cinder::gl::GlslProgRef getGridLinesProgram() {
+    using namespace ds::ui::shader;
+    return getProgram({150, GridLinesVertex(), LinesFragment(), LinesGeometry()});
+}
+
+//! @brief Get the program that draws one instance of a mesh per cell of a range of grid cells.
+//! @note Each instance derives its cell from `gl_InstanceID`, so the program needs no instance attributes. The
+//! program's `gridSpacing`, `gridFirstCell`, `gridColumns` and `cellRadius` uniforms are shared, so they must be
+//! set before each draw.
+
+inline cinder::gl::GlslProgRef getGridCellsProgram() {
+    using namespace ds::ui::shader;
+    return getProgram({150, GridCellsVertex(), GridCellsFragment()});
+}
+
+//! @brief Get the program that draws instanced, coloured rectangles from `QuadInstance` data.
+
+inline cinder::gl::GlslProgRef getQuadsProgram() {
+    using namespace ds::ui::shader;
+    return getProgram({150, QuadsVertex(), QuadsFragment()});
+}
+
+//! @brief Get the program that draws a grid's lines analytically over a single rectangle.
+//! @note The program's `gridExtent`, `gridSpacing`, `gridDimensions` and `LineThickness` uniforms are shared, so
+//! they must be set before each draw.
+
+inline cinder::gl::GlslProgRef getAnalyticGridProgram() {
+    using namespace ds::ui::shader;
+    return getProgram({150, AnalyticGridVertex(), AnalyticGridFragment()});
+}
+
+}
\ No newline at end of file
@@ -6,10 +6,13 @@
 namespace ds::ui {
 
 void Rule::init() {
+    DS_PROFILE_SCOPE("Rule", Rebuild);
+
     auto const border = ci::geom::Rect({0.0f, 0.0f, size().w, 1.0f});
     auto const colour = cinder::gl::ShaderDef().color();
     auto const shader = cinder::gl::getStockShader(colour);
 
+    DS_PROFILE_CREATION(Batch);
     rule = cinder::gl::Batch::create(border, shader);
 }
 
@@ -22,21 +25,24 @@ void Rule::draw(Point<float> const& offset) {
 }
 
 void Rule::draw(float offsetX, float offsetY) {
+    DS_PROFILE_SCOPE("Rule", Draw);
+
     if (shouldRedraw) {
         shouldRedraw = false;
         init();
     }
 
-    cinder::gl::pushModelMatrix();
-    cinder::gl::translate(offsetX, offsetY);
-    cinder::gl::translate(origin().x, origin().y);
-    cinder::gl::translate(0.0f, 0.5f * (size().h - thickness));
-    cinder::gl::scale(1.0f, thickness);
-    cinder::gl::color(1.0f, 1.0f, 1.0f);
+    auto& renderer = getRenderer();
+    renderer.pushTransform();
+    renderer.translate(offsetX, offsetY);
+    renderer.translate(origin().x, origin().y);
+    renderer.translate(0.0f, 0.5f * (size().h - thickness));
+    renderer.scale(1.0f, thickness);
+    renderer.colour({1.0f, 1.0f, 1.0f});
 
-    rule->draw();
+    renderer.drawBatch(&rule);
 
-    cinder::gl::popModelMatrix();
+    renderer.popTransform();
 }
 
 }
\ No newline at end of file
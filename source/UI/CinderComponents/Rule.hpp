@@ -7,6 +7,8 @@
 #include <cinder/gl/gl.h>
 #include <Shaders/Lines.hpp>
 #include <UI/Components/Grid.hpp>
+#include <UI/CinderComponents/CinderRenderer.hpp>
+#include <Profiling/Profiler.hpp>
 
 namespace ds::ui {
 
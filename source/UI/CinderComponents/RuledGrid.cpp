@@ -6,33 +6,74 @@
 namespace ds::ui {
 
 void RuledGrid::init() {
-    auto const grid = ci::gl::VertBatch::create(GL_LINES);
+    DS_PROFILE_SCOPE("RuledGrid", Rebuild);
 
-    for (int row = 0; row <= dimensions().y; ++row) {
-        auto const x = static_cast<float>(size().x);
-        auto const y = static_cast<float>(row) * spacing().h;
-        grid->vertex(0, y, 0);
-        grid->vertex(x, y, 0);
+    viewportScale = ci::vec2(cinder::app::getWindowSize());
+    createRules(getGridLinesProgram());
+}
+
+void RuledGrid::createRules(cinder::gl::GlslProgRef const& shader) {
+    auto const& vertices = lines.getVertices();
+    auto const sizeInBytes = vertices.size() * sizeof(GridLineVertex);
+    lineVertices = ci::gl::Vbo::create(GL_ARRAY_BUFFER, sizeInBytes, vertices.data(), GL_DYNAMIC_DRAW);
+    lines.clearDirtyRanges();
+
+    ci::geom::BufferLayout layout;
+    layout.append(ci::geom::Attrib::CUSTOM_0, 4, sizeof(GridLineVertex), 0);
+
+    auto const vertexCount = static_cast<uint32_t>(vertices.size());
+    auto const mesh = ci::gl::VboMesh::create(vertexCount, GL_LINES, {{layout, lineVertices}});
+
+    DS_PROFILE_CREATION(Batch);
+    rules = cinder::gl::Batch::create(mesh, shader, {
+            {ci::geom::Attrib::CUSTOM_0, "iGridLine"}
+    });
+}
+
+void RuledGrid::updateRules() {
+    auto const shader = rules->getGlslProg();
+
+    if (geometryPool != nullptr) {
+        if (auto const layout = lines.getReallocation(dimensions().h, dimensions().w)) {
+            pendingLines.request(*geometryPool, [layout = *layout] {
+                return generateGridLines(layout);
+            });
+
+            return;
+        }
+
+        pendingLines.cancel();
     }
 
-    for (int col = 0; col <= dimensions().x; ++col) {
-        auto const x = static_cast<float>(col) * spacing().w;
-        auto const y = static_cast<float>(size().y);
-        grid->vertex(x, 0, 0);
-        grid->vertex(x, y, 0);
+    if (lines.setDimensions(dimensions().h, dimensions().w)) {
+        createRules(shader);
+    } else {
+        auto const& vertices = lines.getVertices();
+        for (auto const& range: lines.getDirtyRanges()) {
+            auto const offset = range.first * sizeof(GridLineVertex);
+            auto const sizeInBytes = range.count * sizeof(GridLineVertex);
+            lineVertices->bufferSubData(offset, sizeInBytes, vertices.data() + range.first);
+        }
+
+        lines.clearDirtyRanges();
     }
+}
 
-    auto const program = cinder::gl::GlslProg::Format().version(150)
-                                                       .vertex(ds::ui::shader::LinesVertex())
-                                                       .fragment(ds::ui::shader::LinesFragment())
-                                                       .geometry(ds::ui::shader::LinesGeometry());
+commands::RuleUniforms RuledGrid::getRuleUniforms() const {
+    // Until the reallocated buffer is ready, draw the current lines at the dimensions they were written for.
+    auto const gridDimensions = pendingLines.isPending() ? Size<int> {lines.getColumns(), lines.getRows()} :
+                                dimensions();
 
-    auto const shader = cinder::gl::GlslProg::create(program);
+    return {thickness, {viewportScale.x, viewportScale.y}, spacing(), gridDimensions};
+}
 
-    shader->uniform("LineThickness", thickness);
-    shader->uniform("ViewportScale", ci::vec2(cinder::app::getWindowSize()));
+void RuledGrid::drawRules() {
+    auto const horizontal = lines.getHorizontalRange();
+    auto const vertical = lines.getVerticalRange();
 
-    rules = cinder::gl::Batch::create(*grid, shader);
+    auto& renderer = getRenderer();
+    renderer.drawBatch(&rules, static_cast<int>(horizontal.first), static_cast<int>(horizontal.count));
+    renderer.drawBatch(&rules, static_cast<int>(vertical.first), static_cast<int>(vertical.count));
 }
 
 void RuledGrid::draw() {
@@ -44,28 +85,29 @@ void RuledGrid::draw(Point<float> const& offset) {
 }
 
 void RuledGrid::draw(float const offsetX, float const offsetY) {
+    DS_PROFILE_SCOPE("RuledGrid", Draw);
+
     if (shouldRedraw) {
         shouldRedraw = false;
-        init();
+        updateRules();
     }
 
-    cinder::gl::pushModelMatrix();
-    cinder::gl::translate(offsetX, offsetY);
-    cinder::gl::translate(origin().x, origin().y);
-    cinder::gl::color(1.0f, 1.0f, 1.0f);
-
-    rules->draw();
+    if (auto geometry = pendingLines.take()) {
+        lines.adopt(std::move(*geometry));
+        createRules(rules->getGlslProg());
+    }
 
-    cinder::gl::popModelMatrix();
+    commands::drawRuledGrid(getRenderer(), &rules, {offsetX, offsetY}, origin(), getRuleUniforms(), [this] {
+        drawRules();
+    });
 }
 
 void RuledGrid::adjustToLayout() {
-    rules->getGlslProg()->uniform("ViewportScale", ci::vec2(cinder::app::getWindowSize()));
+    viewportScale = ci::vec2(cinder::app::getWindowSize());
 }
 
 void RuledGrid::setLineThickness(float const lineThickness) {
     thickness = std::max(0.5f, lineThickness * 0.5f);
-    rules->getGlslProg()->uniform("LineThickness", thickness);
 }
 
-}
\ No newline at end of file
+}
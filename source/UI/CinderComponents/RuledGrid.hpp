@@ -4,7 +4,12 @@
 #pragma once
 
 #include <UI/Components/Grid.hpp>
-#include <Shaders/Lines.hpp>
+#include <UI/CinderComponents/Programs.hpp>
+#include <UI/CinderComponents/CinderRenderer.hpp>
+#include <UI/Rendering/ComponentCommands.hpp>
+#include <Profiling/Profiler.hpp>
+#include <UI/Geometry/GridLines.hpp>
+#include <Concurrency/PendingResult.hpp>
 #include <cinder/app/app.h>
 #include <cinder/gl/gl.h>
 #include <algorithm>
@@ -14,17 +19,33 @@ namespace ds::ui {
 class RuledGrid: public Grid {
 public:
     RuledGrid(int const rows, int const columns):
-            Grid(rows, columns) {
+            Grid(rows, columns),
+            lines(rows, columns) {
         init();
     }
 
     RuledGrid(int const rows, int const columns, ds::ui::Size<float> const& cellSize):
-            Grid(rows, columns, cellSize) {
+            Grid(rows, columns, cellSize),
+            lines(rows, columns) {
         init();
     }
 
 private:
     void init();
+    void createRules(cinder::gl::GlslProgRef const& shader);
+
+protected:
+    //! @brief Bring the grid's line geometry and uniforms up to date with its dimensions and spacing.
+
+    virtual void updateRules();
+
+    //! @brief Draw the grid's lines.
+
+    virtual void drawRules();
+
+    //! @brief Get the uniforms of the grid's shared program for the current draw.
+
+    [[nodiscard]] commands::RuleUniforms getRuleUniforms() const;
 
 public:
     void draw() override;
@@ -44,10 +65,26 @@ public:
 
     void setLineThickness(float lineThickness);
 
+    //! @brief Generate the grid's line geometry on the given pool whenever its buffer must be reallocated.
+    //! @note Until the new buffer is ready, the grid keeps drawing its current lines, and the buffer is uploaded
+    //! the next time the grid is drawn after it is ready.
+    //! @param pool The pool that should generate the geometry, or `nullptr` to generate it while drawing.
+
+    inline void setGeometryPool(ds::concurrency::WorkStealingPool* const pool) {
+        geometryPool = pool;
+    }
+
 protected:
     float thickness {2.0f};
+    ci::vec2 viewportScale {};
+
+protected:
+    GridLineBuffer lines;
+    ds::concurrency::WorkStealingPool* geometryPool {nullptr};
+    ds::concurrency::PendingResult<GridLineGeometry> pendingLines;
 
 protected:
+    cinder::gl::VboRef lineVertices;
     cinder::gl::BatchRef rules;
 };
 
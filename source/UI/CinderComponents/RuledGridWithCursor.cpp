@@ -6,12 +6,15 @@
 namespace ds::ui {
 
 void RuledGridWithCursor::init() {
+    DS_PROFILE_SCOPE("RuledGridWithCursor", Rebuild);
+
     auto const position = getCursorPosition().toFloat();
     auto const border = ci::Rectf(position.x, position.y, spacing().x, spacing().y);
     auto const colour = ci::gl::ShaderDef().color();
     auto const shader = ci::gl::getStockShader(colour);
     auto const button = ci::geom::Rect(border);
 
+    DS_PROFILE_CREATION(Batch);
     cursor = cinder::gl::Batch::create(button, shader);
 }
 
@@ -24,20 +27,23 @@ void RuledGridWithCursor::draw(Point<float> const& offset) {
 }
 
 void RuledGridWithCursor::draw(float const offsetX, float const offsetY) {
+    DS_PROFILE_SCOPE("RuledGridWithCursor", Draw);
+
     if (shouldRedraw) {
         init();
     }
 
     auto const position = origin() + spacing() * getCursorPosition().toFloat();
 
-    cinder::gl::pushModelMatrix();
-    cinder::gl::translate(offsetX, offsetY);
-    cinder::gl::translate(position.x, position.y);
-    cinder::gl::color(1.0f, 1.0f, 1.0f);
+    auto& renderer = getRenderer();
+    renderer.pushTransform();
+    renderer.translate(offsetX, offsetY);
+    renderer.translate(position.x, position.y);
+    renderer.colour({1.0f, 1.0f, 1.0f});
 
-    cursor->draw();
+    renderer.drawBatch(&cursor);
 
-    cinder::gl::popModelMatrix();
+    renderer.popTransform();
 
     RuledGrid::draw(offsetX, offsetY);
 }
@@ -77,10 +83,14 @@ bool RuledGridWithCursor::isCursorInBounds(CursorEvent const& event) const {
 }
 
 void RuledGridWithCursor::targetWasPressed(CursorEvent const& event) {
+    DS_PROFILE_SCOPE("RuledGridWithCursor", Event);
+
     moveCursorTo(event.xy);
 }
 
 void RuledGridWithCursor::cursorDidDrag(CursorEvent const& event) {
+    DS_PROFILE_SCOPE("RuledGridWithCursor", Event);
+
     if (isBeingPressed()) {
         moveCursorTo(event.xy);
     }
@@ -6,12 +6,20 @@
 namespace ds::ui {
 
 void RuledGridWithSelection::init() {
+    DS_PROFILE_SCOPE("RuledGridWithSelection", Rebuild);
+
     auto const border = ci::Rectf(0.0f, 0.0f, 1.0f, 1.0f);
     auto const colour = ci::gl::ShaderDef().color();
     auto const shader = ci::gl::getStockShader(colour);
     auto const button = ci::geom::Rect(border);
 
+    DS_PROFILE_CREATION(Batch);
     marquee = cinder::gl::Batch::create(button, shader);
+
+    if (auto const size = cells.getDimensions(); size.w != dimensions().w or size.h != dimensions().h) {
+        cells.setDimensions(dimensions().h, dimensions().w);
+        selection.resetSelection();
+    }
 }
 
 void RuledGridWithSelection::draw() {
@@ -23,40 +31,62 @@ void RuledGridWithSelection::draw(Point<float> const& offset) {
 }
 
 void RuledGridWithSelection::draw(float const offsetX, float const offsetY) {
+    DS_PROFILE_SCOPE("RuledGridWithSelection", Draw);
+
     if (shouldRedraw) {
         init();
     }
 
-    if (selection.containsSelection()) {
-        auto const scaleFactor = selection.size().toFloat() * spacing();
-        auto const translation = selection.origin().toFloat() * spacing() + origin();
-
-        cinder::gl::pushModelMatrix();
-        cinder::gl::translate(offsetX, offsetY);
-        cinder::gl::translate(translation.x, translation.y);
-        cinder::gl::scale(scaleFactor.x, scaleFactor.y);
-        cinder::gl::color(1.0f, 1.0f, 1.0f, 0.6f);
-
-        marquee->draw();
-
-        cinder::gl::popModelMatrix();
+    if (not cells.empty()) {
+        auto& renderer = getRenderer();
+        renderer.colour({1.0f, 1.0f, 1.0f, 0.6f});
+
+        auto const drawRectangle = [&](Bounds<int> const& rectangle) {
+            auto const scaleFactor = rectangle.size().toFloat() * spacing();
+            auto const translation = rectangle.origin().toFloat() * spacing() + origin();
+
+            renderer.pushTransform();
+            renderer.translate(offsetX, offsetY);
+            renderer.translate(translation.x, translation.y);
+            renderer.scale(scaleFactor.x, scaleFactor.y);
+            renderer.drawBatch(&marquee);
+            renderer.popTransform();
+        };
+
+        if (cells.isSingleRectangle()) {
+            drawRectangle(cells.getBounds());
+        } else {
+            cells.forEachRun([&drawRectangle](int const row, int const column, int const length) {
+                drawRectangle({column, row, length, 1});
+            });
+        }
     }
 
     RuledGridWithCursor::draw(offsetX, offsetY);
 }
 
 ds::ui::Bounds<int> RuledGridWithSelection::getSelectionBounds() const {
-    if (selection.containsSelection()) {
-        return {selection.origin(), selection.size()};
+    if (not cells.empty()) {
+        return cells.getBounds();
     } else {
         return {position.x, position.y, 1, 1};
     }
 }
 
+void RuledGridWithSelection::addToSelection(Bounds<int> const& rectangle) {
+    selection.resetSelection();
+    cells.add(rectangle);
+}
+
+void RuledGridWithSelection::subtractFromSelection(Bounds<int> const& rectangle) {
+    selection.resetSelection();
+    cells.subtract(rectangle);
+}
+
 void RuledGridWithSelection::moveCursor(GridPosition::Direction const&& direction) {
     RuledGridWithCursor::moveCursor(std::forward<GridPosition::Direction const>(direction));
 
-    selection.resetSelection();
+    resetSelection();
 }
 
 void RuledGridWithSelection::moveCursor(GridPosition::Direction const&& direction, bool const shouldExtendSelection) {
@@ -64,25 +94,32 @@ void RuledGridWithSelection::moveCursor(GridPosition::Direction const&& directio
         selection.buildSelection(position);
         RuledGridWithCursor::moveCursor(std::forward<const Direction>(direction));
         selection.buildSelection(position);
+        updateSelection();
     } else {
         return moveCursor(std::forward<const Direction>(direction));
     }
 }
 
 void RuledGridWithSelection::cursorWasDown(CursorEvent const& event) {
+    DS_PROFILE_SCOPE("RuledGridWithSelection", Event);
+
     RuledGridWithCursor::cursorWasDown(event);
 
     if (isCursorHovering()) {
-        selection.resetSelection();
+        resetSelection();
     }
 }
 
 void RuledGridWithSelection::targetWasPressed(CursorEvent const& event) {
+    DS_PROFILE_SCOPE("RuledGridWithSelection", Event);
+
     RuledGridWithCursor::targetWasPressed(event);
     processCursorEvent(event);
 }
 
 void RuledGridWithSelection::cursorDidDrag(CursorEvent const& event) {
+    DS_PROFILE_SCOPE("RuledGridWithSelection", Event);
+
     RuledGridWithCursor::cursorDidDrag(event);
 
     if (isBeingPressed()) {
@@ -92,11 +129,22 @@ void RuledGridWithSelection::cursorDidDrag(CursorEvent const& event) {
 
 void RuledGridWithSelection::processCursorEvent(CursorEvent const& event) {
     if (event.leftButtonIsPressed) {
-        selection.resetSelection();
+        resetSelection();
     } else if (event.rightButtonIsPressed) {
         auto const xy = getGridPositionAtPoint(event.xy);
         selection.buildSelection(xy);
+        updateSelection();
     }
 }
 
+void RuledGridWithSelection::resetSelection() {
+    selection.resetSelection();
+    cells.clear();
+}
+
+void RuledGridWithSelection::updateSelection() {
+    // A marquee replaces the selection with a single rectangle, which the selection stores without a bitset.
+    cells.select({selection.origin(), selection.size()});
+}
+
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <UI/Constructs/CellSelection.hpp>
 #include <UI/Constructs/MarqueeSelection.hpp>
 #include <UI/CinderComponents/RuledGridWithCursor.hpp>
 
@@ -11,12 +12,14 @@ namespace ds::ui {
 class RuledGridWithSelection: public RuledGridWithCursor {
 public:
     RuledGridWithSelection(int const rows, int const columns):
-            RuledGridWithCursor(rows, columns) {
+            RuledGridWithCursor(rows, columns),
+            cells(rows, columns) {
         init();
     }
 
     RuledGridWithSelection(int const rows, int const columns, ds::ui::Size<float> const& cellSize):
-            RuledGridWithCursor(rows, columns, cellSize) {
+            RuledGridWithCursor(rows, columns, cellSize),
+            cells(rows, columns) {
         init();
     }
 
@@ -29,10 +32,26 @@ public:
     void draw(float offsetX, float offsetY) override;
 
 public:
-    //! @brief Get the bounds of the marquee selection if one exists or the cursor position otherwise.
+    //! @brief Get the bounds of the selection if one exists or the cursor position otherwise.
 
     [[nodiscard]] ds::ui::Bounds<int> getSelectionBounds() const;
 
+    //! @brief Get the selected cells.
+
+    [[nodiscard]] inline CellSelection const& getSelection() const {
+        return cells;
+    }
+
+    //! @brief Add the given rectangle of cells to the selection.
+    //! @param rectangle The rectangle to be added, in cells.
+
+    void addToSelection(Bounds<int> const& rectangle);
+
+    //! @brief Remove the given rectangle of cells from the selection.
+    //! @param rectangle The rectangle to be removed, in cells.
+
+    void subtractFromSelection(Bounds<int> const& rectangle);
+
 public:
     void moveCursor(Direction const&& direction) override;
 
@@ -51,9 +70,12 @@ protected:
 
 private:
     void processCursorEvent(CursorEvent const& event);
+    void resetSelection();
+    void updateSelection();
 
 private:
     MarqueeSelection selection;
+    CellSelection cells;
 
 private:
     cinder::gl::BatchRef marquee;
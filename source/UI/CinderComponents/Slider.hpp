@@ -40,13 +40,31 @@ public:
             }, minimumValue, sliderStateVariable.load(), maximumValue) {
     }
 
+    //! @brief Create a slider that publishes each change to its value to a parameter of the given bridge.
+    //! @param bridge The bridge that the slider's values should be published to.
+    //! @param parameter The identifier of the parameter.
+    //! @param minimumValue The minimum value of the slider's range.
+    //! @param initialValue The slider's initial value.
+    //! @param maximumValue The maximum value of the slider's range.
+
+    Slider(ds::concurrency::ParameterBridge& bridge,
+           std::uint32_t parameter,
+           Type minimumValue,
+           Type initialValue,
+           Type maximumValue):
+            Slider(nullptr, minimumValue, initialValue, maximumValue) {
+        this->setParameterBinding({&bridge, parameter});
+    }
+
     //! @brief Create a slider that invokes the given function when its state changes.
+    //! @note The function is stored inline, so a callable object larger than `DefaultInlineCapacity` must first be
+    //! wrapped in a `std::function`.
     //! @param callback The function that should be invoked when the slider's state changes.
     //! @param minimumValue The minimum value of the slider's range.
     //! @param initialValue The slider's initial value.
     //! @param maximumValue The maximum value of the slider's range.
 
-    Slider(std::function<void(Type)> callback,
+    Slider(ds::events::InlineFunction<void(Type)> callback,
            Type minimumValue,
            Type initialValue,
            Type maximumValue):
@@ -57,6 +75,8 @@ public:
 
 private:
     inline void init() {
+        DS_PROFILE_SCOPE("Slider", Rebuild);
+
         auto const trackShape = ci::geom::Rect({0.0f, 0.0f, 1.0f, 1.0f});
         auto const colour = ci::gl::ShaderDef().color();
         auto const shader = ci::gl::getStockShader(colour);
@@ -64,7 +84,9 @@ private:
                 .radius(spacing().y * 0.35f)
                 .subdivisions(32);
 
+        DS_PROFILE_CREATION(Batch);
         track = cinder::gl::Batch::create(trackShape, shader);
+        DS_PROFILE_CREATION(Batch);
         handle = cinder::gl::Batch::create(circle, shader);
     }
 
@@ -78,49 +100,56 @@ public:
     }
 
     inline void draw(float const offsetX, float const offsetY) override {
+        DS_PROFILE_SCOPE("Slider", Draw);
+
         if (shouldRedraw) {
             init();
         }
 
+        SliderState<Type>::flushParameterBinding();
+
         Rule::draw(offsetX, offsetY);
 
-        cinder::gl::pushModelMatrix();
-        cinder::gl::translate(offsetX, offsetY);
-        cinder::gl::translate(origin().x, origin().y);
-        cinder::gl::translate(0.0f, 0.5f * size().h);
+        auto& renderer = getRenderer();
+        renderer.pushTransform();
+        renderer.translate(offsetX, offsetY);
+        renderer.translate(origin().x, origin().y);
+        renderer.translate(0.0f, 0.5f * size().h);
 
         auto const position = SliderState<Type>::getSliderPosition() * size().w;
         drawSliderTrack(position);
         drawSliderHandle(position);
 
-        cinder::gl::popModelMatrix();
+        renderer.popTransform();
     }
 
 private:
     inline void drawSliderTrack(float const trackLength) const {
-        cinder::gl::pushModelMatrix();
-        cinder::gl::translate(0.0f, -0.5f * thickness);
-        cinder::gl::scale(trackLength, thickness);
-        cinder::gl::color(trackColour);
+        auto& renderer = getRenderer();
+        renderer.pushTransform();
+        renderer.translate(0.0f, -0.5f * thickness);
+        renderer.scale(trackLength, thickness);
+        renderer.colour(toColour(trackColour));
 
-        track->draw();
+        renderer.drawBatch(&track);
 
-        cinder::gl::popModelMatrix();
+        renderer.popTransform();
     }
 
     inline void drawSliderHandle(float const handleOffset) const {
-        cinder::gl::pushModelMatrix();
-        cinder::gl::translate(handleOffset, 0.0f);
-        cinder::gl::color(1.0f, 1.0f, 1.0f);
+        auto& renderer = getRenderer();
+        renderer.pushTransform();
+        renderer.translate(handleOffset, 0.0f);
+        renderer.colour({1.0f, 1.0f, 1.0f});
 
         if (SliderState<Type>::isCursorHovering()) {
             auto const k = SliderState<Type>::isBeingPressed() ? 0.5f : 0.8f;
-            cinder::gl::color(k, k, k);
+            renderer.colour({k, k, k});
         }
 
-        handle->draw();
+        renderer.drawBatch(&handle);
 
-        cinder::gl::popModelMatrix();
+        renderer.popTransform();
     }
 
 public:
@@ -0,0 +1,20 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+namespace ds::ui {
+
+//! @struct An RGBA colour whose components lie between 0 and 1.
+
+struct Colour {
+    float r {1.0f};
+    float g {1.0f};
+    float b {1.0f};
+    float a {1.0f};
+
+public:
+    inline bool operator==(Colour const& other) const = default;
+};
+
+}
@@ -46,6 +46,12 @@ public:
     }
 
 public:
+    //! @brief Indicate whether the component should be redrawn.
+
+    [[nodiscard]] inline bool getShouldRedraw() const {
+        return shouldRedraw;
+    }
+
     //! @brief Indicate that the component should be redrawn.
 
     inline void setShouldRedraw(bool const componentShouldRedraw) {
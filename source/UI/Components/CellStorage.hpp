@@ -0,0 +1,364 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <bit>
+#include <array>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <UI/Bounds.hpp>
+
+namespace ds::ui {
+
+//! @class A sparse store of per-cell values for a grid, which allocates storage in square chunks of cells.
+//! @note A chunk is allocated when one of its cells is first set, so the memory used is proportional to the number
+//! of chunks touched rather than to the size of the grid. Each change marks its chunk as dirty, so that a renderer
+//! can upload only the chunks that changed. Regions are given in cells and are half-open, such that a region with
+//! origin (x, y) and size (w, h) covers the columns `[x, x + w)` and rows `[y, y + h)`, as a `MarqueeSelection` does.
+
+template <typename T, int ChunkSize = 64>
+class CellStorage {
+public:
+    static_assert(ChunkSize > 0 and ChunkSize % 8 == 0, "The chunk size must be a positive multiple of 8");
+    static_assert(std::is_default_constructible_v<T>, "The cell values must be default constructible");
+
+    static constexpr int CellsPerChunk = ChunkSize * ChunkSize;
+
+public:
+    //! @struct The coordinate of a chunk, in chunks.
+
+    struct ChunkCoordinate {
+        int x {0};
+        int y {0};
+
+        bool operator==(ChunkCoordinate const& other) const = default;
+    };
+
+public:
+    //! @brief Create an empty store for a grid with the given dimensions.
+    //! @param rows The grid's number of rows.
+    //! @param columns The grid's number of columns.
+
+    CellStorage(int const rows, int const columns):
+            dimensions(std::max(0, columns), std::max(0, rows)) {
+    }
+
+public:
+    //! @brief Set the value of the given cell, which is ignored if the cell lies outside the grid.
+    //! @param cell The column and row of the cell.
+    //! @param value The desired value.
+
+    void set(Point<int> const& cell, T const& value) {
+        if (not isInGrid(cell)) {
+            return;
+        }
+
+        auto& chunk = getOrCreateChunk(getChunkCoordinate(cell));
+        auto const index = getCellIndex(cell);
+        auto const word = static_cast<std::size_t>(index / 64);
+        auto const bit = std::uint64_t {1} << (index % 64);
+
+        if ((chunk.occupied[word] & bit) == 0) {
+            chunk.occupied[word] = chunk.occupied[word] | bit;
+            chunk.count = chunk.count + 1;
+            cellCount = cellCount + 1;
+        }
+
+        chunk.values[static_cast<std::size_t>(index)] = value;
+        markDirty(chunk);
+    }
+
+    //! @brief Remove the value of the given cell.
+    //! @param cell The column and row of the cell.
+
+    void erase(Point<int> const& cell) {
+        if (auto* const chunk = findChunk(cell); chunk != nullptr) {
+            eraseFromChunk(*chunk, getCellIndex(cell));
+        }
+    }
+
+    //! @brief Remove the value of every cell and release every chunk.
+
+    void clear() {
+        for (auto& [key, chunk]: chunks) {
+            if (chunk->count > 0) {
+                markDirty(*chunk);
+            }
+        }
+
+        releaseEmptyChunks(true);
+        cellCount = 0;
+    }
+
+    //! @brief Release the chunks that no longer hold any values.
+
+    inline void shrink() {
+        releaseEmptyChunks(false);
+    }
+
+    //! @brief Set the dimensions of the grid, removing the values of the cells that lie outside it.
+    //! @param rows The desired number of rows.
+    //! @param columns The desired number of columns.
+
+    void setDimensions(int const rows, int const columns) {
+        dimensions = {std::max(0, columns), std::max(0, rows)};
+
+        for (auto& [key, chunk]: chunks) {
+            auto const origin = Point<int>(chunk->coordinate.x * ChunkSize, chunk->coordinate.y * ChunkSize);
+            if (origin.x + ChunkSize <= dimensions.w and origin.y + ChunkSize <= dimensions.h) {
+                continue;
+            }
+
+            auto& target = *chunk;
+            forEachInChunk(target, {0, 0, dimensions.w, dimensions.h}, [&](Point<int> const& cell, T const&) {
+                eraseFromChunk(target, getCellIndex(cell));
+            }, true);
+        }
+
+        shrink();
+    }
+
+public:
+    //! @brief Get the value of the given cell, or a default value if the cell has none.
+    //! @param cell The column and row of the cell.
+
+    [[nodiscard]] T const& get(Point<int> const& cell) const {
+        auto const* const chunk = findChunk(cell);
+        return chunk != nullptr ? chunk->values[static_cast<std::size_t>(getCellIndex(cell))] : empty;
+    }
+
+    //! @brief Indicate whether the given cell has a value.
+    //! @param cell The column and row of the cell.
+
+    [[nodiscard]] bool isOccupied(Point<int> const& cell) const {
+        auto const* const chunk = findChunk(cell);
+        if (chunk == nullptr) {
+            return false;
+        }
+
+        auto const index = getCellIndex(cell);
+        return (chunk->occupied[static_cast<std::size_t>(index / 64)] >> (index % 64) & 1u) != 0;
+    }
+
+    //! @brief Get the number of cells that have a value.
+
+    [[nodiscard]] inline std::size_t size() const {
+        return cellCount;
+    }
+
+    //! @brief Get the number of allocated chunks.
+
+    [[nodiscard]] inline std::size_t getChunkCount() const {
+        return chunks.size();
+    }
+
+    //! @brief Get the grid's dimensions in terms of columns (w) and rows (h).
+
+    [[nodiscard]] inline Size<int> const& getDimensions() const {
+        return dimensions;
+    }
+
+public:
+    //! @brief Visit each cell that has a value within the given region, in chunk order and then in row order.
+    //! @param region The region of interest, in cells.
+    //! @param visitor A callable with the signature `void(Point<int> const&, T const&)`.
+
+    template <typename Visitor>
+    void forEachInRegion(Bounds<int> const& region, Visitor&& visitor) const {
+        auto const first = getChunkCoordinate(region.origin());
+        auto const last = getChunkCoordinate(region.origin() + region.size() - Point<int>(1, 1));
+        if (region.size().w <= 0 or region.size().h <= 0) {
+            return;
+        }
+
+        auto const chunksInRegion = static_cast<std::size_t>(last.x - first.x + 1) *
+                                    static_cast<std::size_t>(last.y - first.y + 1);
+
+        // A region that spans more chunks than are allocated is cheaper to visit by scanning the allocated chunks.
+        if (chunksInRegion > chunks.size()) {
+            for (auto const& [key, chunk]: chunks) {
+                auto const& c = chunk->coordinate;
+                if (c.x >= first.x and c.x <= last.x and c.y >= first.y and c.y <= last.y) {
+                    forEachInChunk(*chunk, region, visitor, false);
+                }
+            }
+
+            return;
+        }
+
+        for (auto y = first.y; y <= last.y; ++y) {
+            for (auto x = first.x; x <= last.x; ++x) {
+                if (auto const iterator = chunks.find(getChunkKey({x, y})); iterator != chunks.end()) {
+                    forEachInChunk(*iterator->second, region, visitor, false);
+                }
+            }
+        }
+    }
+
+public:
+    //! @brief Get the chunks that changed since the dirty chunks were last cleared, in the order they first changed.
+
+    [[nodiscard]] inline std::vector<ChunkCoordinate> const& getDirtyChunks() const {
+        return dirtyChunks;
+    }
+
+    //! @brief Indicate that the dirty chunks have been uploaded.
+
+    void clearDirtyChunks() {
+        for (auto const& coordinate: dirtyChunks) {
+            if (auto const iterator = chunks.find(getChunkKey(coordinate)); iterator != chunks.end()) {
+                iterator->second->isDirty = false;
+            }
+        }
+
+        dirtyChunks.clear();
+        releasedDirtyChunks.clear();
+    }
+
+    //! @brief Get the region covered by the given chunk, in cells, clipped to the grid.
+    //! @param coordinate The coordinate of the chunk.
+
+    [[nodiscard]] Bounds<int> getChunkBounds(ChunkCoordinate const& coordinate) const {
+        auto const x = coordinate.x * ChunkSize;
+        auto const y = coordinate.y * ChunkSize;
+
+        return {x, y, std::clamp(dimensions.w - x, 0, ChunkSize), std::clamp(dimensions.h - y, 0, ChunkSize)};
+    }
+
+    //! @brief Get the coordinate of the chunk that holds the given cell.
+    //! @param cell The column and row of the cell.
+
+    [[nodiscard]] static inline ChunkCoordinate getChunkCoordinate(Point<int> const& cell) {
+        return {floorDivide(cell.x), floorDivide(cell.y)};
+    }
+
+private:
+    struct Chunk {
+        ChunkCoordinate coordinate {};
+        std::array<T, CellsPerChunk> values {};
+        std::array<std::uint64_t, CellsPerChunk / 64> occupied {};
+        int count {0};
+        bool isDirty {false};
+    };
+
+private:
+    [[nodiscard]] inline bool isInGrid(Point<int> const& cell) const {
+        return cell.x >= 0 and cell.y >= 0 and cell.x < dimensions.w and cell.y < dimensions.h;
+    }
+
+    [[nodiscard]] static inline int floorDivide(int const value) {
+        return value >= 0 ? value / ChunkSize : -((-value + ChunkSize - 1) / ChunkSize);
+    }
+
+    [[nodiscard]] static inline int getCellIndex(Point<int> const& cell) {
+        auto const x = cell.x - floorDivide(cell.x) * ChunkSize;
+        auto const y = cell.y - floorDivide(cell.y) * ChunkSize;
+        return y * ChunkSize + x;
+    }
+
+    [[nodiscard]] static inline std::uint64_t getChunkKey(ChunkCoordinate const& coordinate) {
+        return static_cast<std::uint64_t>(static_cast<std::uint32_t>(coordinate.x)) << 32 |
+               static_cast<std::uint32_t>(coordinate.y);
+    }
+
+    [[nodiscard]] Chunk* findChunk(Point<int> const& cell) const {
+        if (not isInGrid(cell)) {
+            return nullptr;
+        }
+
+        auto const iterator = chunks.find(getChunkKey(getChunkCoordinate(cell)));
+        return iterator != chunks.end() ? iterator->second.get() : nullptr;
+    }
+
+    Chunk& getOrCreateChunk(ChunkCoordinate const& coordinate) {
+        auto& chunk = chunks[getChunkKey(coordinate)];
+        if (chunk == nullptr) {
+            chunk = std::make_unique<Chunk>();
+            chunk->coordinate = coordinate;
+
+            // A chunk that was released while dirty is already listed among the dirty chunks.
+            chunk->isDirty = releasedDirtyChunks.erase(getChunkKey(coordinate)) > 0;
+        }
+
+        return *chunk;
+    }
+
+    void eraseFromChunk(Chunk& chunk, int const index) {
+        auto const word = static_cast<std::size_t>(index / 64);
+        auto const bit = std::uint64_t {1} << (index % 64);
+
+        if ((chunk.occupied[word] & bit) != 0) {
+            chunk.occupied[word] = chunk.occupied[word] & ~bit;
+            chunk.values[static_cast<std::size_t>(index)] = T {};
+            chunk.count = chunk.count - 1;
+            cellCount = cellCount - 1;
+            markDirty(chunk);
+        }
+    }
+
+    inline void markDirty(Chunk& chunk) {
+        if (not chunk.isDirty) {
+            chunk.isDirty = true;
+            dirtyChunks.push_back(chunk.coordinate);
+        }
+    }
+
+    void releaseEmptyChunks(bool const releaseAll) {
+        std::erase_if(chunks, [this, releaseAll](auto const& entry) {
+            auto const isReleased = releaseAll or entry.second->count == 0;
+            if (isReleased and entry.second->isDirty) {
+                releasedDirtyChunks.insert(entry.first);
+            }
+
+            return isReleased;
+        });
+    }
+
+    //! @brief Visit each occupied cell of the given chunk that lies within the given region.
+    //! @param invert Whether to visit the occupied cells that lie outside the region instead.
+
+    template <typename Visitor>
+    static void forEachInChunk(Chunk const& chunk, Bounds<int> const& region, Visitor&& visitor, bool const invert) {
+        auto const originX = chunk.coordinate.x * ChunkSize;
+        auto const originY = chunk.coordinate.y * ChunkSize;
+        auto const& from = region.origin();
+        auto const to = region.origin() + region.size();
+
+        for (std::size_t word = 0; word < chunk.occupied.size(); ++word) {
+            auto bits = chunk.occupied[word];
+
+            while (bits != 0) {
+                auto const index = static_cast<int>(word * 64) + std::countr_zero(bits);
+                bits = bits & (bits - 1);
+
+                auto const cell = Point<int>(originX + index % ChunkSize, originY + index / ChunkSize);
+                auto const isInRegion = cell.x >= from.x and cell.y >= from.y and cell.x < to.x and cell.y < to.y;
+
+                if (isInRegion != invert) {
+                    visitor(cell, chunk.values[static_cast<std::size_t>(index)]);
+                }
+            }
+        }
+    }
+
+private:
+    Size<int> dimensions;
+    std::size_t cellCount {0};
+
+private:
+    std::unordered_map<std::uint64_t, std::unique_ptr<Chunk>> chunks;
+    std::vector<ChunkCoordinate> dirtyChunks;
+    std::unordered_set<std::uint64_t> releasedDirtyChunks;
+
+private:
+    static inline T const empty {};
+};
+
+}
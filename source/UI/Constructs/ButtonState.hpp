@@ -3,9 +3,10 @@
 
 #pragma once
 
-#include <functional>
 #include <UI/Component.hpp>
+#include <Events/Delegate.hpp>
 #include <Events/CursorTarget.hpp>
+#include <Profiling/Profiler.hpp>
 
 namespace ds::ui {
 
@@ -16,15 +17,18 @@ enum class ButtonStateType {
 };
 
 //! @class The state underlying a button.
+//! @tparam Callback The type of the function invoked as the button state changes. By default, the function is
+//! stored inline without allocating, but a lambda's own type can be given so that each call can be inlined.
 
-template <ButtonStateType ButtonType = ButtonStateType::Latch>
+template <ButtonStateType ButtonType = ButtonStateType::Latch,
+          typename Callback = ds::events::InlineFunction<void(bool buttonState)>>
 class ButtonState: public ds::ui::CursorTarget {
 public:
     //! @brief Create a button state with the given callback function and initial state.
     //! @param callback The function to be invoked as the button state changes.
     //! @param initialState The initial state of the button.
 
-    ButtonState(std::function<void(bool buttonState)>&& callback,
+    ButtonState(Callback&& callback,
                 bool const initialState): ds::ui::CursorTarget(),
                                           buttonCallback(std::move(callback)),
                                           buttonIsPressed(initialState) {
@@ -48,17 +52,24 @@ public:
 
 protected:
     inline void targetWasPressed(CursorEvent const& event) override {
-        /* Latch implementation */
+        DS_PROFILE_SCOPE("Button", Event);
+
+        if constexpr (ButtonType == ButtonStateType::Momentary) {
+            buttonIsPressed = !buttonIsPressed;
+            buttonStateWasToggled();
+        }
     }
 
     inline void targetWasReleased(CursorEvent const& event) override {
+        DS_PROFILE_SCOPE("Button", Event);
+
         buttonIsPressed = !buttonIsPressed;
         buttonStateWasToggled();
     }
 
 private:
-    inline void buttonStateWasToggled() const {
-        if (buttonCallback) {
+    inline void buttonStateWasToggled() {
+        if (ds::events::isCallable(buttonCallback)) {
             buttonCallback(buttonIsPressed);
         }
     }
@@ -67,13 +78,7 @@ protected:
     bool buttonIsPressed {false};
 
 protected:
-    std::function<void(bool buttonState)> buttonCallback;
+    Callback buttonCallback;
 };
 
-template <>
-inline void ButtonState<ButtonStateType::Momentary>::targetWasPressed(CursorEvent const& event) {
-    buttonIsPressed = !buttonIsPressed;
-    buttonStateWasToggled();
-}
-
 }
\ No newline at end of file
@@ -0,0 +1,406 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <bit>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <UI/Bounds.hpp>
+
+namespace ds::ui {
+
+//! @class A set of selected cells in a grid, which may be built from several rectangles.
+//! @note A selection that is a single rectangle, such as a marquee selection, is stored as that rectangle and
+//! costs O(1) to replace, intersect, test and count. Other selections are stored as a bitset with one word-aligned
+//! row of bits per grid row, so that combining a selection with a rectangle touches each of the rectangle's words
+//! once, and iterating the selection skips empty words. Rectangles are given in cells and are half-open, such that a
+//! rectangle with origin (x, y) and size (w, h) covers the columns `[x, x + w)` and the rows `[y, y + h)`.
+
+class CellSelection {
+public:
+    //! @brief Create an empty selection of a grid with the given dimensions.
+    //! @param rows The grid's number of rows.
+    //! @param columns The grid's number of columns.
+
+    CellSelection(int const rows, int const columns):
+            rows(std::max(0, rows)),
+            columns(std::max(0, columns)),
+            wordsPerRow(static_cast<std::size_t>((this->columns + 63) / 64)) {
+    }
+
+public:
+    //! @brief Replace the selection with the given rectangle.
+    //! @param rectangle The rectangle to be selected.
+
+    inline void select(Bounds<int> const& rectangle) {
+        setRectangle(clip(rectangle));
+    }
+
+    //! @brief Add the given rectangle to the selection.
+    //! @param rectangle The rectangle to be added.
+
+    void add(Bounds<int> const& rectangle) {
+        auto const area = clip(rectangle);
+        if (isEmpty(area)) {
+            return;
+        }
+
+        if (isRectangle) {
+            if (selectedCount == 0 or encloses(area, bounds)) {
+                return setRectangle(area);
+            } else if (encloses(bounds, area)) {
+                return;
+            }
+
+            materialise();
+        }
+
+        bounds = selectedCount == 0 ? area : getUnion(bounds, area);
+        applyToRows(area, [](std::uint64_t const word, std::uint64_t const mask) {
+            return word | mask;
+        });
+    }
+
+    //! @brief Remove the given rectangle from the selection.
+    //! @param rectangle The rectangle to be removed.
+
+    void subtract(Bounds<int> const& rectangle) {
+        auto const area = getIntersection(clip(rectangle), bounds);
+        if (selectedCount == 0 or isEmpty(area)) {
+            return;
+        }
+
+        if (isRectangle) {
+            if (encloses(area, bounds)) {
+                return clear();
+            }
+
+            materialise();
+        }
+
+        applyToRows(area, [](std::uint64_t const word, std::uint64_t const mask) {
+            return word & ~mask;
+        });
+    }
+
+    //! @brief Remove every cell outside the given rectangle from the selection.
+    //! @param rectangle The rectangle to be intersected with.
+
+    void intersect(Bounds<int> const& rectangle) {
+        auto const area = getIntersection(clip(rectangle), bounds);
+        if (selectedCount == 0) {
+            return;
+        }
+
+        if (isRectangle or isEmpty(area)) {
+            return setRectangle(area);
+        }
+
+        // Only the rows of the current bounds can hold selected cells, so only they need to be masked.
+        auto const outside = bounds;
+        bounds = area;
+
+        for (auto row = outside.origin().y; row < outside.origin().y + outside.size().h; ++row) {
+            auto* const line = getRow(row);
+
+            for (std::size_t word = 0; word < wordsPerRow; ++word) {
+                auto const isRowInside = row >= area.origin().y and row < area.origin().y + area.size().h;
+                auto const mask = isRowInside ? getColumnMask(word, area) : std::uint64_t {0};
+                auto const updated = line[word] & mask;
+
+                selectedCount = selectedCount - static_cast<std::size_t>(std::popcount(line[word] ^ updated));
+                line[word] = updated;
+            }
+        }
+    }
+
+    //! @brief Deselect every cell.
+
+    inline void clear() {
+        setRectangle({0, 0, 0, 0});
+    }
+
+    //! @brief Set the dimensions of the grid, deselecting every cell.
+    //! @param newRows The desired number of rows.
+    //! @param newColumns The desired number of columns.
+
+    void setDimensions(int const newRows, int const newColumns) {
+        rows = std::max(0, newRows);
+        columns = std::max(0, newColumns);
+        wordsPerRow = static_cast<std::size_t>((columns + 63) / 64);
+        words.clear();
+        clear();
+    }
+
+public:
+    //! @brief Indicate whether the given cell is selected.
+    //! @param cell The column (x) and row (y) of the cell.
+
+    [[nodiscard]] inline bool contains(Point<int> const& cell) const {
+        if (not isInside(bounds, cell)) {
+            return false;
+        }
+
+        if (isRectangle) {
+            return true;
+        }
+
+        auto const word = getRow(cell.y)[static_cast<std::size_t>(cell.x / 64)];
+        return (word >> (cell.x % 64) & 1u) != 0;
+    }
+
+    //! @brief Get the number of selected cells.
+
+    [[nodiscard]] inline std::size_t count() const {
+        return selectedCount;
+    }
+
+    //! @brief Indicate whether no cell is selected.
+
+    [[nodiscard]] inline bool empty() const {
+        return selectedCount == 0;
+    }
+
+    //! @brief Get the grid's dimensions in terms of columns (w) and rows (h).
+
+    [[nodiscard]] inline Size<int> getDimensions() const {
+        return {columns, rows};
+    }
+
+    //! @brief Indicate whether the selection is stored as a single rectangle.
+
+    [[nodiscard]] inline bool isSingleRectangle() const {
+        return isRectangle;
+    }
+
+    //! @brief Get the smallest rectangle that encloses every selected cell.
+
+    [[nodiscard]] Bounds<int> getBounds() const {
+        if (isRectangle or selectedCount == 0) {
+            return bounds;
+        }
+
+        auto left = columns;
+        auto right = 0;
+        auto top = rows;
+        auto bottom = 0;
+
+        forEachRun([&](int const row, int const column, int const length) {
+            left = std::min(left, column);
+            right = std::max(right, column + length);
+            top = std::min(top, row);
+            bottom = std::max(bottom, row + 1);
+        });
+
+        return {left, top, right - left, bottom - top};
+    }
+
+public:
+    //! @brief Visit each selected cell in row-major order.
+    //! @param visitor A callable with the signature `void(Point<int> const&)`.
+
+    template <typename Visitor>
+    void forEach(Visitor&& visitor) const {
+        if (isRectangle) {
+            for (auto row = bounds.origin().y; row < bounds.origin().y + bounds.size().h; ++row) {
+                for (auto column = bounds.origin().x; column < bounds.origin().x + bounds.size().w; ++column) {
+                    visitor(Point<int>(column, row));
+                }
+            }
+
+            return;
+        }
+
+        for (auto row = bounds.origin().y; row < bounds.origin().y + bounds.size().h; ++row) {
+            auto const* const line = getRow(row);
+
+            for (std::size_t word = 0; word < wordsPerRow; ++word) {
+                for (auto bits = line[word]; bits != 0; bits = bits & (bits - 1)) {
+                    visitor(Point<int>(static_cast<int>(word * 64) + std::countr_zero(bits), row));
+                }
+            }
+        }
+    }
+
+    //! @brief Visit each horizontal run of selected cells in row-major order, so that a row of selected cells can be
+    //! drawn as one rectangle.
+    //! @param visitor A callable with the signature `void(int row, int column, int length)`.
+
+    template <typename Visitor>
+    void forEachRun(Visitor&& visitor) const {
+        if (selectedCount == 0) {
+            return;
+        }
+
+        if (isRectangle) {
+            for (auto row = bounds.origin().y; row < bounds.origin().y + bounds.size().h; ++row) {
+                visitor(row, bounds.origin().x, bounds.size().w);
+            }
+
+            return;
+        }
+
+        for (auto row = bounds.origin().y; row < bounds.origin().y + bounds.size().h; ++row) {
+            auto const* const line = getRow(row);
+            auto runStart = -1;
+
+            for (std::size_t word = 0; word < wordsPerRow; ++word) {
+                auto bits = line[word];
+                auto position = 0;
+
+                // Alternately skip the unselected and the selected bits of the word, so that each run is found
+                // with a pair of bit scans rather than a test per cell.
+                while (position < 64) {
+                    auto const column = static_cast<int>(word * 64) + position;
+
+                    if (runStart < 0) {
+                        auto const skipped = std::countr_zero(bits >> position);
+                        if (skipped >= 64 - position) {
+                            break;
+                        }
+
+                        runStart = column + skipped;
+                        position = position + skipped;
+                    } else {
+                        auto const length = std::countr_one(bits >> position);
+                        if (length >= 64 - position) {
+                            break;
+                        }
+
+                        visitor(row, runStart, column + length - runStart);
+                        runStart = -1;
+                        position = position + length;
+                    }
+                }
+            }
+
+            if (runStart >= 0) {
+                visitor(row, runStart, std::min(columns, static_cast<int>(wordsPerRow * 64)) - runStart);
+            }
+        }
+    }
+
+private:
+    [[nodiscard]] static inline bool isEmpty(Bounds<int> const& rectangle) {
+        return rectangle.size().w <= 0 or rectangle.size().h <= 0;
+    }
+
+    [[nodiscard]] static inline bool isInside(Bounds<int> const& rectangle, Point<int> const& cell) {
+        return cell.x >= rectangle.origin().x and cell.x < rectangle.origin().x + rectangle.size().w and
+               cell.y >= rectangle.origin().y and cell.y < rectangle.origin().y + rectangle.size().h;
+    }
+
+    [[nodiscard]] static inline bool encloses(Bounds<int> const& outer, Bounds<int> const& inner) {
+        return inner.origin().x >= outer.origin().x and inner.origin().y >= outer.origin().y and
+               inner.origin().x + inner.size().w <= outer.origin().x + outer.size().w and
+               inner.origin().y + inner.size().h <= outer.origin().y + outer.size().h;
+    }
+
+    [[nodiscard]] static Bounds<int> getIntersection(Bounds<int> const& a, Bounds<int> const& b) {
+        auto const left = std::max(a.origin().x, b.origin().x);
+        auto const top = std::max(a.origin().y, b.origin().y);
+        auto const right = std::min(a.origin().x + a.size().w, b.origin().x + b.size().w);
+        auto const bottom = std::min(a.origin().y + a.size().h, b.origin().y + b.size().h);
+
+        if (right <= left or bottom <= top) {
+            return {0, 0, 0, 0};
+        }
+
+        return {left, top, right - left, bottom - top};
+    }
+
+    [[nodiscard]] static Bounds<int> getUnion(Bounds<int> const& a, Bounds<int> const& b) {
+        auto const left = std::min(a.origin().x, b.origin().x);
+        auto const top = std::min(a.origin().y, b.origin().y);
+        auto const right = std::max(a.origin().x + a.size().w, b.origin().x + b.size().w);
+        auto const bottom = std::max(a.origin().y + a.size().h, b.origin().y + b.size().h);
+
+        return {left, top, right - left, bottom - top};
+    }
+
+    [[nodiscard]] inline Bounds<int> clip(Bounds<int> const& rectangle) const {
+        return getIntersection(rectangle, {0, 0, columns, rows});
+    }
+
+    //! @brief Get the bits of the given word that lie within the columns of the given rectangle.
+
+    [[nodiscard]] static inline std::uint64_t getColumnMask(std::size_t const word, Bounds<int> const& rectangle) {
+        auto const first = static_cast<int>(word * 64);
+        auto const from = std::clamp(rectangle.origin().x - first, 0, 64);
+        auto const to = std::clamp(rectangle.origin().x + rectangle.size().w - first, 0, 64);
+
+        if (from >= to) {
+            return 0;
+        }
+
+        auto const upper = to == 64 ? ~std::uint64_t {0} : (std::uint64_t {1} << to) - 1;
+        return upper & ~((std::uint64_t {1} << from) - 1);
+    }
+
+    [[nodiscard]] inline std::uint64_t* getRow(int const row) {
+        return words.data() + static_cast<std::size_t>(row) * wordsPerRow;
+    }
+
+    [[nodiscard]] inline std::uint64_t const* getRow(int const row) const {
+        return words.data() + static_cast<std::size_t>(row) * wordsPerRow;
+    }
+
+    //! @brief Replace the selection with the given clipped rectangle, without touching the bitset.
+
+    inline void setRectangle(Bounds<int> const& area) {
+        isRectangle = true;
+        bounds = isEmpty(area) ? Bounds<int>(0, 0, 0, 0) : area;
+        selectedCount = static_cast<std::size_t>(bounds.size().w) * static_cast<std::size_t>(bounds.size().h);
+    }
+
+    //! @brief Write the rectangular selection into the bitset.
+
+    void materialise() {
+        words.assign(static_cast<std::size_t>(rows) * wordsPerRow, 0);
+        isRectangle = false;
+
+        auto const area = bounds;
+        selectedCount = 0;
+
+        applyToRows(area, [](std::uint64_t const word, std::uint64_t const mask) {
+            return word | mask;
+        });
+    }
+
+    //! @brief Combine each word that overlaps the given clipped rectangle with the rectangle's mask for that word.
+
+    template <typename Operation>
+    void applyToRows(Bounds<int> const& area, Operation&& operation) {
+        auto const firstWord = static_cast<std::size_t>(area.origin().x / 64);
+        auto const lastWord = static_cast<std::size_t>((area.origin().x + area.size().w - 1) / 64);
+
+        for (auto row = area.origin().y; row < area.origin().y + area.size().h; ++row) {
+            auto* const line = getRow(row);
+
+            for (auto word = firstWord; word <= lastWord; ++word) {
+                auto const updated = operation(line[word], getColumnMask(word, area));
+                selectedCount = selectedCount - static_cast<std::size_t>(std::popcount(line[word]))
+                                              + static_cast<std::size_t>(std::popcount(updated));
+                line[word] = updated;
+            }
+        }
+    }
+
+private:
+    int rows;
+    int columns;
+    std::size_t wordsPerRow;
+
+private:
+    bool isRectangle {true};
+    Bounds<int> bounds {0, 0, 0, 0};
+    std::size_t selectedCount {0};
+
+private:
+    std::vector<std::uint64_t> words;
+};
+
+}
@@ -0,0 +1,124 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <algorithm>
+#include <string_view>
+#include <type_traits>
+#include <system_error>
+
+namespace ds::ui {
+
+//! @class A formatter that writes numbers into a fixed buffer without allocating.
+//! @note Floating-point values are written in fixed notation with the given precision, as `std::fixed` with
+//! `std::setprecision` would write them, and fall back to scientific notation if they do not fit. Integral
+//! values are written in full, and the units, if any, follow the number.
+
+template <typename T, std::size_t Capacity = 48>
+class NumberFormat {
+public:
+    //! @brief Create a formatter with the given precision and units.
+    //! @param precision The number of digits after the decimal point of a floating-point value.
+    //! @param units A suffix to be written after each value, which is truncated to fit the buffer.
+
+    explicit NumberFormat(int const precision = 2, std::string_view const units = {}):
+            precision(std::max(0, precision)) {
+        static_assert(std::is_integral_v<T> or std::is_floating_point_v<T>,
+                      "The given type must either be integral or floating point");
+
+        setUnits(units);
+    }
+
+public:
+    //! @brief Format the given value.
+    //! @param value The value to be formatted.
+    //! @return Whether the formatted text differs from the previously formatted text.
+
+    bool format(T const value) {
+        std::array<char, Capacity> buffer;
+        auto const numberLength = formatNumber(buffer.data(), buffer.data() + Capacity - unitsLength, value);
+        std::copy_n(units.data(), unitsLength, buffer.data() + numberLength);
+
+        auto const length = numberLength + unitsLength;
+        if (hasText and length == textLength and std::equal(buffer.data(), buffer.data() + length, text.data())) {
+            return false;
+        }
+
+        std::copy_n(buffer.data(), length, text.data());
+        textLength = length;
+        hasText = true;
+
+        return true;
+    }
+
+public:
+    //! @brief Get the most recently formatted text.
+
+    [[nodiscard]] inline std::string_view view() const {
+        return {text.data(), textLength};
+    }
+
+    //! @brief Get the number of digits written after the decimal point of a floating-point value.
+
+    [[nodiscard]] inline int getPrecision() const {
+        return precision;
+    }
+
+    //! @brief Get the units written after each value.
+
+    [[nodiscard]] inline std::string_view getUnits() const {
+        return {units.data(), unitsLength};
+    }
+
+public:
+    //! @brief Set the number of digits written after the decimal point of a floating-point value.
+    //! @param digits The desired precision.
+
+    inline void setPrecision(int const digits) {
+        precision = std::max(0, digits);
+        hasText = false;
+    }
+
+    //! @brief Set the units written after each value.
+    //! @param suffix The desired units, which are truncated to leave room for the number.
+
+    inline void setUnits(std::string_view const suffix) {
+        unitsLength = std::min(suffix.size(), Capacity / 2);
+        std::copy_n(suffix.data(), unitsLength, units.data());
+        hasText = false;
+    }
+
+private:
+    inline std::size_t formatNumber(char* const first, char* const last, T const value) const {
+        std::to_chars_result result;
+
+        if constexpr (std::is_floating_point_v<T>) {
+            result = std::to_chars(first, last, value, std::chars_format::fixed, precision);
+            if (result.ec != std::errc {}) {
+                result = std::to_chars(first, last, value, std::chars_format::scientific, precision);
+            }
+        } else {
+            result = std::to_chars(first, last, value);
+        }
+
+        return result.ec == std::errc {} ? static_cast<std::size_t>(result.ptr - first) : 0;
+    }
+
+private:
+    int precision;
+    bool hasText {false};
+
+private:
+    std::array<char, Capacity> text {};
+    std::size_t textLength {0};
+
+private:
+    std::array<char, Capacity / 2> units {};
+    std::size_t unitsLength {0};
+};
+
+}
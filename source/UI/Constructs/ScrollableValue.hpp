@@ -5,6 +5,8 @@
 
 #include <type_traits>
 #include "Events/CursorTarget.hpp"
+#include "Concurrency/ParameterBridge.hpp"
+#include "Profiling/Profiler.hpp"
 
 namespace ds::ui {
 
@@ -90,8 +92,24 @@ public:
         scrollScale = scaleValue;
     }
 
+    //! @brief Publish each change to the value to the given parameter of a `ParameterBridge`.
+    //! @param binding The desired parameter, or an empty binding to stop publishing.
+
+    inline void setParameterBinding(ds::concurrency::ParameterBinding const& binding) {
+        parameterBinding = binding;
+    }
+
+    //! @brief Retry any changes to the value that the bound `ParameterBridge` could not yet pass to its worker.
+    //! @note A component that draws the value calls this each frame.
+
+    inline void flushParameterBinding() const {
+        parameterBinding.flush();
+    }
+
 protected:
     void cursorWasDown(CursorEvent const& event) override {
+        DS_PROFILE_SCOPE("ScrollableValue", Event);
+
         if (isCursorInBounds(event)) {
             auto const delta = static_cast<double>(lastDownPosition.y - event.xy.y) * scrollScale;
             updateScrollableValue(isBeingPressed() ? delta : 0.0);
@@ -100,6 +118,8 @@ protected:
     }
 
     void cursorDidDrag(CursorEvent const& event) override {
+        DS_PROFILE_SCOPE("ScrollableValue", Event);
+
         if (isBeingPressed()) {
             auto const delta = static_cast<double>(lastDownPosition.y - event.xy.y) * scrollScale;
             updateScrollableValue(delta);
@@ -123,6 +143,7 @@ private:
         sourceValue = std::max(static_cast<double>(minimum), sourceValue);
         value = static_cast<T>(sourceValue);
 
+        parameterBinding.publish(value);
         didUpdateScrollableValue();
     }
 
@@ -133,6 +154,9 @@ private:
     double scrollScale {0.5};
     double sourceValue {0.0};
 
+private:
+    ds::concurrency::ParameterBinding parameterBinding {};
+
 private:
     Point<int> lastDownPosition {};
 };
@@ -4,20 +4,26 @@
 #pragma once
 
 #include <algorithm>
-#include <functional>
 #include <type_traits>
+#include <Events/Delegate.hpp>
 #include <Events/CursorTarget.hpp>
+#include <Concurrency/ParameterBridge.hpp>
+#include <Profiling/Profiler.hpp>
 #include <iostream>
 
 namespace ds::ui {
 
-template <typename T>
+//! @class The state underlying a slider.
+//! @tparam Callback The type of the function invoked as the slider state changes. By default, the function is
+//! stored inline without allocating, but a lambda's own type can be given so that each call can be inlined.
+
+template <typename T, typename Callback = ds::events::InlineFunction<void(T sliderValue)>>
 class SliderState: public ds::ui::CursorTarget {
 public:
     //! @brief Create a slider state with the given callback function.
     //! @param callback The function to be invoked as the slider state changes.
 
-    explicit SliderState(std::function<void(T sliderValue)>&& callback):
+    explicit SliderState(Callback&& callback):
             SliderState(static_cast<T>(0),
                         static_cast<T>(0),
                         static_cast<T>(1),
@@ -33,7 +39,7 @@ public:
     SliderState(T const minimumValue,
                 T const initialValue,
                 T const maximumValue,
-                std::function<void(T sliderValue)>&& callback):
+                Callback&& callback):
             minimum(static_cast<float>(minimumValue)),
             maximum(static_cast<float>(maximumValue)),
             sliderCallback(std::move(callback)) {
@@ -83,14 +89,33 @@ public:
         maximum = static_cast<float>(maximumValue);
     }
 
+    //! @brief Publish each change to the slider's value to the given parameter of a `ParameterBridge`.
+    //! @param binding The desired parameter, or an empty binding to stop publishing.
+
+    inline void setParameterBinding(ds::concurrency::ParameterBinding const& binding) {
+        parameterBinding = binding;
+    }
+
+    //! @brief Retry any published changes that the bound `ParameterBridge` could not yet pass to its worker.
+    //! @note This is called each time the control is drawn, so that the last value of a burst of changes reaches the
+    //! worker even if the control is not changed again.
+
+    inline void flushParameterBinding() const {
+        parameterBinding.flush();
+    }
+
 protected:
     void cursorWasDown(CursorEvent const& event) override {
+        DS_PROFILE_SCOPE("Slider", Event);
+
         if (isCursorInBounds(event)) {
             lastDownPosition = event.xy.x;
         }
     }
 
     void cursorDidDrag(CursorEvent const& event) override {
+        DS_PROFILE_SCOPE("Slider", Event);
+
         if (isBeingPressed()) {
             auto const start = sliderOriginX();
             auto const width = sliderWidthInPixels();
@@ -126,10 +151,12 @@ private:
     void updateSliderValue(float const position) {
         value = std::clamp(position, 0.0f, 1.0f);
 
-        if (sliderCallback) {
+        if (ds::events::isCallable(sliderCallback)) {
             sliderCallback(getValue());
         }
 
+        parameterBinding.publish(getValue());
+
         didUpdateSliderValue();
     }
 
@@ -139,7 +166,8 @@ protected:
     float maximum;
 
 protected:
-    std::function<void(T sliderValue)> sliderCallback;
+    Callback sliderCallback;
+    ds::concurrency::ParameterBinding parameterBinding {};
 
 private:
     int lastDownPosition {};
@@ -0,0 +1,54 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "ButtonInstances.hpp"
+
+namespace ds::ui {
+
+ButtonInstances::ButtonInstances(Bounds<float> const& viewport):
+        viewport(viewport) {
+}
+
+void ButtonInstances::clear() {
+    instances.clear();
+    buttonCount = 0;
+    culledCount = 0;
+}
+
+bool ButtonInstances::add(Bounds<float> const& bounds, Point<float> const& offset, ButtonAppearance const& appearance) {
+    auto const half = appearance.outlineWidth * 0.5f;
+    auto const x = bounds.origin().x + offset.x;
+    auto const y = bounds.origin().y + offset.y;
+    auto const w = bounds.size().w;
+    auto const h = bounds.size().h;
+
+    // The outline extends past the bounds by half of its width, so the outline's extent decides visibility.
+
+    if (not viewport.intersects(Bounds<float>(x - half, y - half, w + 2.0f * half, h + 2.0f * half))) {
+        ++culledCount;
+        return false;
+    }
+
+    if (appearance.isPressed) {
+        instances.push_back({x, y, w, h, appearance.activeColour});
+    }
+
+    if (appearance.isHovering) {
+        instances.push_back({x, y, w, h, {1.0f, 1.0f, 1.0f, appearance.isBeingPressed ? 0.50f : 0.30f}});
+    }
+
+    // Each edge is centred on the border and extended at both ends, as the lines geometry shader draws it.
+
+    auto const outline = Colour {1.0f, 1.0f, 1.0f, 1.0f};
+    auto const width = appearance.outlineWidth;
+    instances.push_back({x - half, y - half, w + width, width, outline});
+    instances.push_back({x - half, y + h - half, w + width, width, outline});
+    instances.push_back({x - half, y - half, width, h + width, outline});
+    instances.push_back({x + w - half, y - half, width, h + width, outline});
+
+    ++buttonCount;
+
+    return true;
+}
+
+}
@@ -0,0 +1,82 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <UI/Bounds.hpp>
+#include "QuadInstance.hpp"
+
+namespace ds::ui {
+
+//! @struct The state of a button that determines how it is drawn.
+
+struct ButtonAppearance {
+    bool isPressed {false};
+    bool isHovering {false};
+    bool isBeingPressed {false};
+    Colour activeColour {};
+    float outlineWidth {1.0f};
+};
+
+//! @class A per-frame buffer of the quads that draw a set of buttons.
+//! @note Each button contributes its fill, its hover highlight and the four edges of its outline, in that order,
+//! so drawing the whole buffer with one instanced draw call reproduces the blending of `Button::draw`.
+
+class ButtonInstances {
+public:
+    //! @brief Create an empty buffer.
+    //! @param viewport The visible region of the screen. Buttons that lie entirely outside it are skipped.
+
+    explicit ButtonInstances(Bounds<float> const& viewport);
+
+public:
+    //! @brief Remove every instance from the buffer while keeping its capacity.
+
+    void clear();
+
+    //! @brief Add the quads of the given button to the buffer.
+    //! @param bounds The bounds of the button.
+    //! @param offset The offset that the button would be drawn with.
+    //! @param appearance The state of the button.
+    //! @return Whether the button was visible and added or not.
+
+    bool add(Bounds<float> const& bounds, Point<float> const& offset, ButtonAppearance const& appearance);
+
+    //! @brief Set the visible region of the screen.
+    //! @param bounds The desired viewport.
+
+    inline void setViewport(Bounds<float> const& bounds) {
+        viewport = bounds;
+    }
+
+public:
+    //! @brief Get the instances added since the buffer was last cleared.
+
+    [[nodiscard]] inline std::vector<QuadInstance> const& getInstances() const {
+        return instances;
+    }
+
+    //! @brief Get the number of buttons added since the buffer was last cleared.
+
+    [[nodiscard]] inline std::size_t getButtonCount() const {
+        return buttonCount;
+    }
+
+    //! @brief Get the number of buttons skipped for lying outside the viewport since the buffer was last cleared.
+
+    [[nodiscard]] inline std::size_t getCulledCount() const {
+        return culledCount;
+    }
+
+private:
+    Bounds<float> viewport;
+
+private:
+    std::vector<QuadInstance> instances;
+    std::size_t buttonCount {0};
+    std::size_t culledCount {0};
+};
+
+}
@@ -0,0 +1,59 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "GridCoverage.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+namespace ds::ui {
+
+namespace {
+
+//! @brief Compute the coverage of the lines perpendicular to one axis, given the position along each axis.
+//! @note This mirrors `lineCoverage` in the `AnalyticGridFragment` shader, which must be kept in step with it.
+
+float getAxisCoverage(float const across, float const along, float const spacing, int const lines,
+                      float const lengthAlong, float const halfThickness, float const pixelSize) {
+    if (spacing <= 0.0f) {
+        return 0.0f;
+    }
+
+    auto const nearest = std::clamp(std::floor(across / spacing + 0.5f), 0.0f, static_cast<float>(lines));
+    auto const distanceAcross = std::abs(across - nearest * spacing);
+    auto const distanceAlong = std::max(-along, along - lengthAlong);
+
+    auto const acrossCoverage = std::clamp((halfThickness - distanceAcross) / pixelSize + 0.5f, 0.0f, 1.0f);
+    auto const alongCoverage = std::clamp((halfThickness - distanceAlong) / pixelSize + 0.5f, 0.0f, 1.0f);
+
+    return acrossCoverage * alongCoverage;
+}
+
+}
+
+float getGridLineCoverage(Point<float> const& point,
+                          Size<float> const& spacing,
+                          Size<int> const& dimensions,
+                          float const halfThickness,
+                          float const pixelSize) {
+    auto const width = spacing.w * static_cast<float>(dimensions.x);
+    auto const height = spacing.h * static_cast<float>(dimensions.y);
+
+    auto const vertical = getAxisCoverage(point.x, point.y, spacing.w, dimensions.x, height, halfThickness, pixelSize);
+    auto const horizontal = getAxisCoverage(point.y, point.x, spacing.h, dimensions.y, width, halfThickness, pixelSize);
+
+    return std::max(vertical, horizontal);
+}
+
+Bounds<float> getGridLineExtent(Size<float> const& spacing,
+                                Size<int> const& dimensions,
+                                float const halfThickness,
+                                float const pixelSize) {
+    auto const margin = halfThickness + pixelSize;
+    auto const width = spacing.w * static_cast<float>(dimensions.x);
+    auto const height = spacing.h * static_cast<float>(dimensions.y);
+
+    return {-margin, -margin, width + 2.0f * margin, height + 2.0f * margin};
+}
+
+}
@@ -0,0 +1,46 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <UI/Bounds.hpp>
+
+namespace ds::ui {
+
+//! @brief Get half of the width in pixels of the lines that the `LinesGeometry` shader draws for a `LineThickness`.
+//! @note The geometry shader offsets each side and end of a line by `LineThickness` in `ViewportScale` units, of
+//! which there are two per pixel, so its lines are `LineThickness` pixels wide and extend half of that past their
+//! ends. `AnalyticGrid` passes this to `getGridLineCoverage` so that its lines match those of `RuledGrid`.
+
+constexpr float getLinesGeometryHalfWidth(float const lineThickness) {
+    return 0.5f * lineThickness;
+}
+
+//! @brief Compute the fraction of a pixel covered by a grid's lines, as the `AnalyticGrid` fragment shader does.
+//! @note The grid has a line at each multiple of the spacing, from the first row and column to the last, inclusive.
+//! Each line extends by half its thickness beyond the grid's edges, so lines meet at square corners as the lines
+//! drawn by `RuledGrid` do. Coverage ramps from 1 to 0 over one pixel around the edge of each line.
+//! @param point The centre of the pixel, relative to the grid's upper-left corner.
+//! @param spacing The size of each cell.
+//! @param dimensions The grid's number of columns (x) and rows (y).
+//! @param halfThickness Half of the thickness of each line.
+//! @param pixelSize The size of a pixel in the grid's space, which is 1 unless the grid is scaled.
+
+float getGridLineCoverage(Point<float> const& point,
+                          Size<float> const& spacing,
+                          Size<int> const& dimensions,
+                          float halfThickness,
+                          float pixelSize = 1.0f);
+
+//! @brief Get the region that must be rasterised to draw every line of a grid, relative to its upper-left corner.
+//! @param spacing The size of each cell.
+//! @param dimensions The grid's number of columns (x) and rows (y).
+//! @param halfThickness Half of the thickness of each line.
+//! @param pixelSize The size of a pixel in the grid's space.
+
+Bounds<float> getGridLineExtent(Size<float> const& spacing,
+                                Size<int> const& dimensions,
+                                float halfThickness,
+                                float pixelSize = 1.0f);
+
+}
@@ -0,0 +1,55 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "GridCulling.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+namespace ds::ui {
+
+namespace {
+
+//! @brief Compute the half-open range of cells along one axis that overlaps the interval `[from, to]`.
+
+void getVisibleSpan(float const from, float const to, float const spacing, int const cells, int& first, int& count) {
+    if (spacing <= 0.0f or cells <= 0 or to < from) {
+        first = 0;
+        count = 0;
+        return;
+    }
+
+    // The limits are clamped as floats first, so that a distant viewport cannot overflow an int.
+    auto const limit = static_cast<float>(cells);
+    auto const lower = static_cast<int>(std::clamp(std::floor(from / spacing), 0.0f, limit));
+    auto const upper = static_cast<int>(std::clamp(std::floor(to / spacing) + 1.0f, 0.0f, limit));
+
+    first = lower;
+    count = std::max(0, upper - lower);
+}
+
+}
+
+CellRange getVisibleCells(Point<float> const& origin,
+                          Size<float> const& spacing,
+                          Size<int> const& dimensions,
+                          Bounds<float> const& viewport,
+                          float const margin) {
+    auto range = CellRange {};
+
+    getVisibleSpan(viewport.origin().x - margin - origin.x,
+                   viewport.origin().x + viewport.size().w + margin - origin.x,
+                   spacing.w, dimensions.x, range.column, range.columns);
+
+    getVisibleSpan(viewport.origin().y - margin - origin.y,
+                   viewport.origin().y + viewport.size().h + margin - origin.y,
+                   spacing.h, dimensions.y, range.row, range.rows);
+
+    if (range.isEmpty()) {
+        return {};
+    }
+
+    return range;
+}
+
+}
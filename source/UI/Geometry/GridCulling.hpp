@@ -0,0 +1,56 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <UI/Bounds.hpp>
+
+namespace ds::ui {
+
+//! @struct A rectangular range of grid cells, which covers the columns `[column, column + columns)` and the rows
+//! `[row, row + rows)`.
+//! @note Instances of the range are numbered in row-major order, as the `GridCells` vertex shader numbers them.
+
+struct CellRange {
+    int column {0};
+    int row {0};
+    int columns {0};
+    int rows {0};
+
+public:
+    //! @brief Get the number of cells in the range.
+
+    [[nodiscard]] inline int count() const {
+        return columns * rows;
+    }
+
+    //! @brief Indicate whether the range contains no cells.
+
+    [[nodiscard]] inline bool isEmpty() const {
+        return columns <= 0 or rows <= 0;
+    }
+
+    //! @brief Get the column (x) and row (y) of the cell drawn by the given instance.
+    //! @param instance The index of the instance, which should be less than `count()`.
+
+    [[nodiscard]] inline Point<int> getCell(int const instance) const {
+        return {column + instance % columns, row + instance / columns};
+    }
+
+    inline bool operator==(CellRange const& other) const = default;
+};
+
+//! @brief Compute the range of a grid's cells that overlap the given viewport.
+//! @param origin The position of the grid's upper-left corner, in the same space as the viewport.
+//! @param spacing The size of each cell.
+//! @param dimensions The grid's number of columns (x) and rows (y).
+//! @param viewport The visible region.
+//! @param margin The distance by which the contents of a cell may extend beyond the cell.
+
+CellRange getVisibleCells(Point<float> const& origin,
+                          Size<float> const& spacing,
+                          Size<int> const& dimensions,
+                          Bounds<float> const& viewport,
+                          float margin = 0.0f);
+
+}
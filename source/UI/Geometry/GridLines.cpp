@@ -0,0 +1,119 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "GridLines.hpp"
+
+#include <algorithm>
+
+namespace ds::ui {
+
+namespace {
+
+void writeLineVertices(std::vector<GridLineVertex>& vertices,
+                       float const orientation,
+                       std::size_t const offset,
+                       std::size_t const firstLine,
+                       std::size_t const lastLine) {
+    for (auto line = firstLine; line < lastLine; ++line) {
+        auto const index = static_cast<float>(line);
+        vertices[offset + 2 * line] = {orientation, index, 0.0f, 0.0f};
+        vertices[offset + 2 * line + 1] = {orientation, index, 1.0f, 0.0f};
+    }
+}
+
+}
+
+GridLineGeometry generateGridLines(GridLineLayout const& layout) {
+    auto const rowLines = static_cast<std::size_t>(layout.rows + 1);
+    auto const columnLines = static_cast<std::size_t>(layout.columns + 1);
+
+    auto geometry = GridLineGeometry {layout, {}};
+    geometry.vertices.assign(2 * (layout.rowCapacity + layout.columnCapacity), {});
+    writeLineVertices(geometry.vertices, GridLineVertex::horizontal, 0, 0, rowLines);
+    writeLineVertices(geometry.vertices, GridLineVertex::vertical, 2 * layout.rowCapacity, 0, columnLines);
+
+    return geometry;
+}
+
+GridLineBuffer::GridLineBuffer(int const rows, int const columns) {
+    setDimensions(rows, columns);
+}
+
+bool GridLineBuffer::setDimensions(int const rowCount, int const columnCount) {
+    if (auto const layout = getReallocation(rowCount, columnCount)) {
+        adopt(generateGridLines(*layout));
+        return true;
+    }
+
+    rows = std::max(0, rowCount);
+    columns = std::max(0, columnCount);
+
+    auto const rowLines = static_cast<std::size_t>(rows + 1);
+    auto const columnLines = static_cast<std::size_t>(columns + 1);
+
+    if (rowLines > writtenRowLines) {
+        writeLines(GridLineVertex::horizontal, 0, writtenRowLines, rowLines);
+        writtenRowLines = rowLines;
+    }
+
+    if (columnLines > writtenColumnLines) {
+        writeLines(GridLineVertex::vertical, 2 * rowCapacity, writtenColumnLines, columnLines);
+        writtenColumnLines = columnLines;
+    }
+
+    return false;
+}
+
+std::optional<GridLineLayout> GridLineBuffer::getReallocation(int const rowCount, int const columnCount) const {
+    auto const boundedRows = std::max(0, rowCount);
+    auto const boundedColumns = std::max(0, columnCount);
+    auto const rowLines = static_cast<std::size_t>(boundedRows + 1);
+    auto const columnLines = static_cast<std::size_t>(boundedColumns + 1);
+
+    if (rowLines <= rowCapacity and columnLines <= columnCapacity) {
+        return std::nullopt;
+    }
+
+    return GridLineLayout {boundedRows, boundedColumns,
+                           std::max(rowLines, rowCapacity * 2),
+                           std::max(columnLines, columnCapacity * 2)};
+}
+
+void GridLineBuffer::adopt(GridLineGeometry&& geometry) {
+    rows = geometry.layout.rows;
+    columns = geometry.layout.columns;
+    rowCapacity = geometry.layout.rowCapacity;
+    columnCapacity = geometry.layout.columnCapacity;
+    writtenRowLines = static_cast<std::size_t>(rows + 1);
+    writtenColumnLines = static_cast<std::size_t>(columns + 1);
+
+    vertices = std::move(geometry.vertices);
+    dirtyRanges.clear();
+    dirtyRanges.push_back({0, 2 * writtenRowLines});
+    dirtyRanges.push_back({2 * rowCapacity, 2 * writtenColumnLines});
+}
+
+Point<float> GridLineBuffer::getPosition(GridLineVertex const& vertex,
+                                         Size<int> const& dimensions,
+                                         Size<float> const& spacing) {
+    auto const columns = static_cast<float>(dimensions.w);
+    auto const rows = static_cast<float>(dimensions.h);
+
+    if (vertex.orientation == GridLineVertex::horizontal) {
+        auto const line = vertex.index + vertex.anchor * rows;
+        return {vertex.end * columns * spacing.w, line * spacing.h};
+    } else {
+        auto const line = vertex.index + vertex.anchor * columns;
+        return {line * spacing.w, vertex.end * rows * spacing.h};
+    }
+}
+
+void GridLineBuffer::writeLines(float const orientation,
+                                std::size_t const offset,
+                                std::size_t const firstLine,
+                                std::size_t const lastLine) {
+    writeLineVertices(vertices, orientation, offset, firstLine, lastLine);
+    dirtyRanges.push_back({offset + 2 * firstLine, 2 * (lastLine - firstLine)});
+}
+
+}
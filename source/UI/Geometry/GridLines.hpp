@@ -0,0 +1,183 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <UI/Size.hpp>
+#include <UI/Point.hpp>
+
+namespace ds::ui {
+
+//! @struct A vertex of a grid line, expressed in terms of the grid rather than in pixels.
+//! @note A horizontal line with index `i` runs from (0, i) to (columns, i) in grid units, and a vertical line with
+//! index `i` runs from (i, 0) to (i, rows). A line whose anchor is 1 is counted back from the far edge of the
+//! grid, so the outline of a grid is the same eight vertices whatever its dimensions. Since no vertex depends
+//! on the grid's dimensions or spacing, neither needs the vertices to be rewritten when it changes.
+
+struct GridLineVertex {
+    float orientation {0.0f};
+    float index {0.0f};
+    float end {0.0f};
+    float anchor {0.0f};
+
+public:
+    static constexpr float horizontal = 0.0f;
+    static constexpr float vertical = 1.0f;
+};
+
+static_assert(std::is_trivially_copyable_v<GridLineVertex>);
+static_assert(sizeof(GridLineVertex) == 4 * sizeof(float));
+
+//! @struct The dimensions of a grid and the number of lines that a grid line buffer has room for.
+
+struct GridLineLayout {
+    int rows {0};
+    int columns {0};
+    std::size_t rowCapacity {0};
+    std::size_t columnCapacity {0};
+};
+
+//! @struct A complete buffer of grid line vertices, ready to be uploaded.
+
+struct GridLineGeometry {
+    GridLineLayout layout {};
+    std::vector<GridLineVertex> vertices;
+};
+
+//! @brief Generate every vertex of a grid line buffer with the given layout.
+//! @note The function is pure, so it can run on any thread, and its result is exactly the buffer that
+//! `GridLineBuffer` writes when it reallocates.
+//! @param layout The dimensions and capacity of the buffer.
+
+[[nodiscard]] GridLineGeometry generateGridLines(GridLineLayout const& layout);
+
+//! @class A persistent buffer of grid line vertices that grows as a grid's dimensions change.
+//! @note Horizontal lines occupy the front of the buffer and vertical lines follow them, each with spare
+//! capacity. Resizing within capacity writes only the lines that have never been written before; lines that are
+//! removed are left in place and excluded from the draw ranges.
+
+class GridLineBuffer {
+public:
+    //! @struct A range of vertices, `[first, first + count)`.
+
+    struct Range {
+        std::size_t first {0};
+        std::size_t count {0};
+    };
+
+public:
+    //! @brief Create a buffer for a grid with the given dimensions.
+    //! @param rows The number of rows.
+    //! @param columns The number of columns.
+
+    GridLineBuffer(int rows, int columns);
+
+public:
+    //! @brief Set the dimensions of the grid.
+    //! @param rows The desired number of rows.
+    //! @param columns The desired number of columns.
+    //! @return Whether the buffer was reallocated, in which case the whole buffer must be uploaded again.
+
+    bool setDimensions(int rows, int columns);
+
+    //! @brief Get the layout that the buffer would be reallocated with if it were given the dimensions.
+    //! @param rows The desired number of rows.
+    //! @param columns The desired number of columns.
+    //! @return The new layout, or nothing if the dimensions fit within the buffer's capacity.
+
+    [[nodiscard]] std::optional<GridLineLayout> getReallocation(int rows, int columns) const;
+
+    //! @brief Replace the buffer's vertices with the given geometry, which must then be uploaded in full.
+    //! @param geometry A buffer produced by `generateGridLines`, which may have been generated on another thread.
+
+    void adopt(GridLineGeometry&& geometry);
+
+    //! @brief Get the ranges of vertices written since the dirty ranges were last cleared.
+
+    [[nodiscard]] inline std::vector<Range> const& getDirtyRanges() const {
+        return dirtyRanges;
+    }
+
+    //! @brief Indicate that the dirty ranges have been uploaded.
+
+    inline void clearDirtyRanges() {
+        dirtyRanges.clear();
+    }
+
+public:
+    //! @brief Get the number of rows whose lines the buffer draws.
+
+    [[nodiscard]] inline int getRows() const {
+        return rows;
+    }
+
+    //! @brief Get the number of columns whose lines the buffer draws.
+
+    [[nodiscard]] inline int getColumns() const {
+        return columns;
+    }
+
+    //! @brief Get every vertex of the buffer, including spare capacity.
+
+    [[nodiscard]] inline std::vector<GridLineVertex> const& getVertices() const {
+        return vertices;
+    }
+
+    //! @brief Get the range of vertices that draws the grid's horizontal lines.
+
+    [[nodiscard]] inline Range getHorizontalRange() const {
+        return {0, 2 * static_cast<std::size_t>(rows + 1)};
+    }
+
+    //! @brief Get the range of vertices that draws the grid's vertical lines.
+
+    [[nodiscard]] inline Range getVerticalRange() const {
+        return {2 * rowCapacity, 2 * static_cast<std::size_t>(columns + 1)};
+    }
+
+public:
+    //! @brief Get the eight vertices that draw the outline of a grid of any dimensions.
+
+    [[nodiscard]] static constexpr std::array<GridLineVertex, 8> getOutlineVertices() {
+        using V = GridLineVertex;
+        return {{
+                {V::horizontal, 0.0f, 0.0f, 0.0f}, {V::horizontal, 0.0f, 1.0f, 0.0f},
+                {V::horizontal, 0.0f, 0.0f, 1.0f}, {V::horizontal, 0.0f, 1.0f, 1.0f},
+                {V::vertical, 0.0f, 0.0f, 0.0f}, {V::vertical, 0.0f, 1.0f, 0.0f},
+                {V::vertical, 0.0f, 0.0f, 1.0f}, {V::vertical, 0.0f, 1.0f, 1.0f}
+        }};
+    }
+
+    //! @brief Compute the position of the given vertex in pixels, as the grid lines vertex shader does.
+    //! @param vertex The vertex to be positioned.
+    //! @param dimensions The dimensions of the grid in columns and rows.
+    //! @param spacing The size of each cell in pixels.
+
+    [[nodiscard]] static Point<float> getPosition(GridLineVertex const& vertex,
+                                                  Size<int> const& dimensions,
+                                                  Size<float> const& spacing);
+
+private:
+    void writeLines(float orientation, std::size_t offset, std::size_t firstLine, std::size_t lastLine);
+
+private:
+    int rows {0};
+    int columns {0};
+
+private:
+    std::size_t rowCapacity {0};
+    std::size_t columnCapacity {0};
+    std::size_t writtenRowLines {0};
+    std::size_t writtenColumnLines {0};
+
+private:
+    std::vector<GridLineVertex> vertices;
+    std::vector<Range> dirtyRanges;
+};
+
+}
@@ -0,0 +1,25 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <type_traits>
+#include <UI/Colour.hpp>
+
+namespace ds::ui {
+
+//! @struct The per-instance attributes of an axis-aligned, filled rectangle.
+//! @note The layout matches two `vec4` attributes, so a buffer of instances can be uploaded as it is.
+
+struct QuadInstance {
+    float x {0.0f};
+    float y {0.0f};
+    float w {0.0f};
+    float h {0.0f};
+    Colour colour {};
+};
+
+static_assert(std::is_trivially_copyable_v<QuadInstance>);
+static_assert(sizeof(QuadInstance) == 8 * sizeof(float));
+
+}
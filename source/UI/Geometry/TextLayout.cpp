@@ -0,0 +1,101 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "TextLayout.hpp"
+
+#include <limits>
+#include <string>
+#include <algorithm>
+
+namespace ds::ui {
+
+GlyphMetrics::GlyphMetrics(float const lineHeight):
+        lineHeight(lineHeight) {
+}
+
+void GlyphMetrics::setGlyph(char const character, Glyph const& glyph) {
+    glyphs[static_cast<unsigned char>(character)] = glyph;
+    hasGlyphs[static_cast<unsigned char>(character)] = true;
+}
+
+Glyph const& GlyphMetrics::getGlyph(char const character) const {
+    return hasGlyph(character) ? glyphs[static_cast<unsigned char>(character)]
+                               : glyphs[static_cast<unsigned char>('?')];
+}
+
+float GlyphMetrics::measure(std::string_view const text) const {
+    auto width = 0.0f;
+    for (auto const character: text) {
+        width = width + getGlyph(character).advance;
+    }
+
+    return width;
+}
+
+TextLayout::TextLayout(GlyphMetrics const& metrics):
+        metrics(&metrics) {
+}
+
+bool TextLayout::setText(std::string_view const newText, float const newBoxWidth, TextAlignment const newAlignment) {
+    text.assign(newText.begin(), newText.end());
+    boxWidth = newBoxWidth;
+    alignment = newAlignment;
+    textWidth = metrics->measure(newText);
+
+    auto penX = 0.0f;
+    switch (alignment) {
+        case TextAlignment::Left: break;
+        case TextAlignment::Centre: penX = 0.5f * (boxWidth - textWidth); break;
+        case TextAlignment::Right: penX = boxWidth - textWidth; break;
+    }
+
+    auto const vertexCount = 6 * newText.size();
+    auto const previousCount = vertices.size();
+    vertices.resize(vertexCount);
+
+    auto firstChange = std::numeric_limits<std::size_t>::max();
+    auto lastChange = std::size_t {0};
+
+    for (std::size_t i = 0; i < newText.size(); ++i) {
+        auto const& glyph = metrics->getGlyph(newText[i]);
+        auto const x0 = penX + glyph.offsetX;
+        auto const y0 = glyph.offsetY;
+        auto const x1 = x0 + glyph.width;
+        auto const y1 = y0 + glyph.height;
+
+        GlyphVertex const quad[6] = {
+                {x0, y0, glyph.u0, glyph.v0}, {x1, y0, glyph.u1, glyph.v0}, {x1, y1, glyph.u1, glyph.v1},
+                {x0, y0, glyph.u0, glyph.v0}, {x1, y1, glyph.u1, glyph.v1}, {x0, y1, glyph.u0, glyph.v1}
+        };
+
+        for (std::size_t k = 0; k < 6; ++k) {
+            auto const index = 6 * i + k;
+            if (index >= previousCount or not(vertices[index] == quad[k])) {
+                vertices[index] = quad[k];
+                firstChange = std::min(firstChange, index);
+                lastChange = index + 1;
+            }
+        }
+
+        penX = penX + glyph.advance;
+    }
+
+    if (firstChange == std::numeric_limits<std::size_t>::max()) {
+        dirtyRange = {};
+        return vertexCount != previousCount;
+    }
+
+    dirtyRange = {firstChange, lastChange - firstChange};
+
+    return true;
+}
+
+void TextLayout::setMetrics(GlyphMetrics const& newMetrics) {
+    metrics = &newMetrics;
+    vertices.clear();
+
+    auto const currentText = std::string(text.begin(), text.end());
+    setText(currentText, boxWidth, alignment);
+}
+
+}
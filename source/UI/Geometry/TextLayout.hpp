@@ -0,0 +1,171 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+namespace ds::ui {
+
+//! @struct The metrics of a glyph and its location in a glyph atlas.
+//! @note Lengths are in pixels, with the glyph's box placed `offsetX` to the right of the pen position and
+//! `offsetY` below the top of the line. Texture coordinates are normalised.
+
+struct Glyph {
+    float advance {0.0f};
+    float offsetX {0.0f};
+    float offsetY {0.0f};
+    float width {0.0f};
+    float height {0.0f};
+    float u0 {0.0f};
+    float v0 {0.0f};
+    float u1 {0.0f};
+    float v1 {0.0f};
+};
+
+//! @struct A vertex of a glyph quad, which holds a position in pixels and a texture coordinate.
+
+struct GlyphVertex {
+    float x {0.0f};
+    float y {0.0f};
+    float u {0.0f};
+    float v {0.0f};
+
+public:
+    inline bool operator==(GlyphVertex const& other) const = default;
+};
+
+static_assert(std::is_trivially_copyable_v<GlyphVertex>);
+static_assert(sizeof(GlyphVertex) == 4 * sizeof(float));
+
+//! @enum The horizontal alignments of a line of text within its box.
+
+enum class TextAlignment {
+    Left, Centre, Right
+};
+
+//! @class The glyphs of one font at one size, indexed by byte.
+
+class GlyphMetrics {
+public:
+    //! @brief Create a set of glyph metrics with no glyphs.
+    //! @param lineHeight The height of a line of text in pixels.
+
+    explicit GlyphMetrics(float lineHeight);
+
+public:
+    //! @brief Set the metrics of the given character.
+    //! @param character The character whose metrics should be set.
+    //! @param glyph The metrics of the character's glyph.
+
+    void setGlyph(char character, Glyph const& glyph);
+
+    //! @brief Get the glyph of the given character, or the glyph of '?' if the character has no glyph.
+    //! @param character The character of interest.
+
+    [[nodiscard]] Glyph const& getGlyph(char character) const;
+
+    //! @brief Indicate whether the given character has a glyph.
+    //! @param character The character of interest.
+
+    [[nodiscard]] inline bool hasGlyph(char const character) const {
+        return hasGlyphs[static_cast<unsigned char>(character)];
+    }
+
+    //! @brief Get the height of a line of text in pixels.
+
+    [[nodiscard]] inline float getLineHeight() const {
+        return lineHeight;
+    }
+
+public:
+    //! @brief Compute the width of the given text in pixels.
+    //! @param text The text to be measured.
+
+    [[nodiscard]] float measure(std::string_view text) const;
+
+private:
+    float lineHeight;
+
+private:
+    std::array<Glyph, 256> glyphs {};
+    std::array<bool, 256> hasGlyphs {};
+};
+
+//! @class A line of text laid out as textured quads that index into a glyph atlas.
+//! @note Each glyph contributes six vertices, forming two triangles. Changing the text rewrites the vertices in
+//! place and records the range that differs from the previous text, so that only that range is uploaded.
+
+class TextLayout {
+public:
+    //! @struct A range of vertices, `[first, first + count)`.
+
+    struct Range {
+        std::size_t first {0};
+        std::size_t count {0};
+    };
+
+public:
+    //! @brief Create an empty text layout.
+    //! @param metrics The glyph metrics, which must outlive the layout.
+
+    explicit TextLayout(GlyphMetrics const& metrics);
+
+public:
+    //! @brief Lay out the given text.
+    //! @param text The text to be laid out.
+    //! @param boxWidth The width of the box that the text is aligned within.
+    //! @param alignment The horizontal alignment of the text within its box.
+    //! @return Whether any vertex changed.
+
+    bool setText(std::string_view text, float boxWidth, TextAlignment alignment = TextAlignment::Left);
+
+    //! @brief Use the given glyph metrics, which must outlive the layout, and lay out the current text again.
+    //! @param newMetrics The desired glyph metrics.
+
+    void setMetrics(GlyphMetrics const& newMetrics);
+
+public:
+    //! @brief Get the vertices of the current text.
+
+    [[nodiscard]] inline std::vector<GlyphVertex> const& getVertices() const {
+        return vertices;
+    }
+
+    //! @brief Get the range of vertices that changed in the most recent call to `setText`.
+
+    [[nodiscard]] inline Range getDirtyRange() const {
+        return dirtyRange;
+    }
+
+    //! @brief Get the width of the current text in pixels.
+
+    [[nodiscard]] inline float getTextWidth() const {
+        return textWidth;
+    }
+
+    //! @brief Get the height of the current text in pixels.
+
+    [[nodiscard]] inline float getTextHeight() const {
+        return metrics->getLineHeight();
+    }
+
+private:
+    GlyphMetrics const* metrics;
+
+private:
+    std::vector<char> text;
+    float boxWidth {0.0f};
+    float textWidth {0.0f};
+    TextAlignment alignment {TextAlignment::Left};
+
+private:
+    std::vector<GlyphVertex> vertices;
+    Range dirtyRange {};
+};
+
+}
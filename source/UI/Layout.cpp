@@ -0,0 +1,272 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "Layout.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+namespace ds::ui {
+
+namespace {
+
+inline bool isEqual(Bounds<float> const& a, Bounds<float> const& b) {
+    return a.origin() == b.origin() and a.size() == b.size();
+}
+
+//! @brief Carve the given length from the given edge of the region and return the carved area.
+
+inline Bounds<float> carve(Bounds<float>& region, float const length, bool const isHorizontal,
+                           LayoutAlignment const alignment) {
+    auto const available = isHorizontal ? region.size().w : region.size().h;
+    auto const extent = std::clamp(length, 0.0f, available);
+
+    if (isHorizontal) {
+        return alignment == LayoutAlignment::Start ? region.trimFromLeft(extent) : region.trimFromRight(extent);
+    } else {
+        return alignment == LayoutAlignment::Start ? region.trimFromTop(extent) : region.trimFromBottom(extent);
+    }
+}
+
+}
+
+Layout::Layout(Size<float> const& cellSize, LayoutDirection const direction):
+        cellSize(cellSize) {
+    nodes.emplace_back();
+    nodes[root].direction = direction;
+}
+
+Layout::NodeId Layout::add(NodeId const parent, LayoutSize const size, LayoutDirection const direction) {
+    NodeId node;
+    if (freeNodes.empty()) {
+        node = nodes.size();
+        nodes.emplace_back();
+    } else {
+        node = freeNodes.back();
+        freeNodes.pop_back();
+    }
+
+    auto& entry = nodes[node];
+    entry.parent = parent;
+    entry.size = size;
+    entry.direction = direction;
+
+    nodes[parent].children.push_back(node);
+    markNeedsLayout(parent);
+
+    return node;
+}
+
+void Layout::remove(NodeId const node) {
+    if (node == root) {
+        return;
+    }
+
+    auto const parent = nodes[node].parent;
+    std::erase(nodes[parent].children, node);
+    releaseNode(node);
+    markNeedsLayout(parent);
+}
+
+void Layout::setSize(NodeId const node, LayoutSize const size) {
+    if (nodes[node].size != size) {
+        nodes[node].size = size;
+        markNeedsLayout(nodes[node].parent);
+    }
+}
+
+void Layout::setDirection(NodeId const node, LayoutDirection const direction) {
+    if (nodes[node].direction != direction) {
+        nodes[node].direction = direction;
+        markNeedsLayout(node);
+    }
+}
+
+void Layout::setAlignment(NodeId const node, LayoutAlignment const alignment) {
+    if (nodes[node].alignment != alignment) {
+        nodes[node].alignment = alignment;
+        markNeedsLayout(nodes[node].parent);
+    }
+}
+
+void Layout::setGap(NodeId const node, float const gap) {
+    if (nodes[node].gap != gap) {
+        nodes[node].gap = std::max(0.0f, gap);
+        markNeedsLayout(node);
+    }
+}
+
+void Layout::bind(NodeId const node, Component& component) {
+    nodes[node].component = &component;
+    nodes[node].grid = nullptr;
+
+    if (nodes[node].isSolved) {
+        apply(nodes[node]);
+    }
+}
+
+void Layout::bind(NodeId const node, Grid& grid) {
+    nodes[node].component = &grid;
+    nodes[node].grid = &grid;
+    nodes[node].isSolved = false;
+
+    // A grid's spacing defines the length of its cells, so the node's parent must be solved again to measure it.
+
+    markNeedsLayout(nodes[node].parent);
+}
+
+void Layout::unbind(NodeId const node) {
+    if (nodes[node].grid != nullptr) {
+        markNeedsLayout(nodes[node].parent);
+    }
+
+    nodes[node].component = nullptr;
+    nodes[node].grid = nullptr;
+}
+
+std::size_t Layout::solve(Bounds<float> const& area) {
+    statistics = {};
+    solveNode(root, area);
+
+    return statistics.solved;
+}
+
+void Layout::solveNode(NodeId const node, Bounds<float> const& area) {
+    ++statistics.visited;
+
+    auto& entry = nodes[node];
+    auto const didChange = not entry.isSolved or not isEqual(entry.bounds, area);
+
+    if (didChange) {
+        entry.bounds = area;
+        entry.isSolved = true;
+        ++statistics.changed;
+        apply(entry);
+    }
+
+    if (didChange or entry.needsLayout) {
+        entry.needsLayout = false;
+        entry.hasDirtyDescendant = false;
+        ++statistics.solved;
+        solveChildren(node);
+    } else if (entry.hasDirtyDescendant) {
+        // The node's own layout is unchanged, so its children keep their areas and only the dirty ones are visited.
+
+        entry.hasDirtyDescendant = false;
+        for (auto const child: entry.children) {
+            if (nodes[child].needsLayout or nodes[child].hasDirtyDescendant) {
+                solveNode(child, nodes[child].bounds);
+            }
+        }
+    }
+}
+
+void Layout::solveChildren(NodeId const node) {
+    auto const& entry = nodes[node];
+    auto const isHorizontal = entry.direction == LayoutDirection::Row;
+    auto const length = isHorizontal ? entry.bounds.size().w : entry.bounds.size().h;
+    auto const count = entry.children.size();
+
+    if (count == 0) {
+        return;
+    }
+
+    // Measure the nodes whose lengths are known, then share what is left between the flexible nodes.
+
+    auto knownLength = entry.gap * static_cast<float>(count - 1);
+    auto totalWeight = 0.0f;
+
+    for (auto const child: entry.children) {
+        auto const& size = nodes[child].size;
+        if (size.kind == LayoutSize::Kind::Flex) {
+            totalWeight = totalWeight + std::max(0.0f, size.value);
+        } else {
+            knownLength = knownLength + getLength(child, length, isHorizontal);
+        }
+    }
+
+    auto const flexibleLength = std::max(0.0f, length - knownLength);
+    auto region = entry.bounds;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        auto const child = nodes[node].children[i];
+        auto const& size = nodes[child].size;
+        auto const alignment = nodes[child].alignment;
+
+        auto const childLength = size.kind != LayoutSize::Kind::Flex ? getLength(child, length, isHorizontal) :
+                                 totalWeight > 0.0f ? flexibleLength * std::max(0.0f, size.value) / totalWeight :
+                                 0.0f;
+
+        auto const area = carve(region, childLength, isHorizontal, alignment);
+        if (i + 1 < count) {
+            carve(region, nodes[node].gap, isHorizontal, alignment);
+        }
+
+        solveNode(child, area);
+    }
+}
+
+void Layout::apply(Node const& node) const {
+    if (node.component == nullptr) {
+        return;
+    }
+
+    if (node.grid != nullptr) {
+        auto& grid = *node.grid;
+        auto const columns = static_cast<int>(std::floor(node.bounds.size().w / grid.spacing().w));
+        auto const rows = static_cast<int>(std::floor(node.bounds.size().h / grid.spacing().h));
+
+        if (grid.dimensions().w != columns or grid.dimensions().h != rows) {
+            grid.setDimensions(rows, columns);
+        }
+    } else {
+        node.component->setSizeFromOrigin(node.bounds.size().w, node.bounds.size().h);
+    }
+
+    node.component->setPositionWithOrigin(node.bounds.origin());
+    node.component->adjustToLayout();
+}
+
+void Layout::markNeedsLayout(NodeId const node) {
+    nodes[node].needsLayout = true;
+
+    auto ancestor = node;
+    while (ancestor != root) {
+        ancestor = nodes[ancestor].parent;
+        if (nodes[ancestor].hasDirtyDescendant) {
+            break;
+        }
+
+        nodes[ancestor].hasDirtyDescendant = true;
+    }
+}
+
+void Layout::releaseNode(NodeId const node) {
+    for (auto const child: nodes[node].children) {
+        releaseNode(child);
+    }
+
+    nodes[node] = {};
+    freeNodes.push_back(node);
+}
+
+float Layout::getLength(NodeId const node, float const parentLength, bool const isHorizontal) const {
+    auto const& entry = nodes[node];
+
+    switch (entry.size.kind) {
+        case LayoutSize::Kind::Fixed:
+            return entry.size.value;
+        case LayoutSize::Kind::Fraction:
+            return entry.size.value * parentLength;
+        case LayoutSize::Kind::Cells: {
+            auto const& spacing = entry.grid != nullptr ? entry.grid->spacing() : cellSize;
+            return entry.size.value * (isHorizontal ? spacing.w : spacing.h);
+        }
+        case LayoutSize::Kind::Flex:
+            return 0.0f;
+    }
+
+    return 0.0f;
+}
+
+}
@@ -0,0 +1,203 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include "Bounds.hpp"
+#include "Component.hpp"
+#include "Components/Grid.hpp"
+
+namespace ds::ui {
+
+//! @enum The axis along which a layout node arranges its children.
+
+enum class LayoutDirection {
+    Row, Column
+};
+
+//! @enum The edge of its parent that a layout node is carved from.
+
+enum class LayoutAlignment {
+    Start, End
+};
+
+//! @struct The length of a layout node along its parent's axis.
+//! @note A fixed length is given in pixels, a fractional length is a proportion of the parent's length, and a
+//! length in cells is a number of grid cells, measured with the spacing of the grid bound to the node or the
+//! layout's cell size otherwise. Flexible nodes share whatever length the other nodes leave, in proportion to
+//! their weights.
+
+struct LayoutSize {
+    enum class Kind {
+        Fixed, Fraction, Cells, Flex
+    };
+
+    Kind kind {Kind::Flex};
+    float value {1.0f};
+
+public:
+    //! @brief A length in pixels.
+
+    static constexpr LayoutSize fixed(float const pixels) {
+        return {Kind::Fixed, pixels};
+    }
+
+    //! @brief A proportion of the parent's length.
+
+    static constexpr LayoutSize fraction(float const proportion) {
+        return {Kind::Fraction, proportion};
+    }
+
+    //! @brief A number of grid cells.
+
+    static constexpr LayoutSize cells(int const count) {
+        return {Kind::Cells, static_cast<float>(count)};
+    }
+
+    //! @brief A share of the length that the other nodes leave.
+
+    static constexpr LayoutSize flex(float const weight = 1.0f) {
+        return {Kind::Flex, weight};
+    }
+
+    constexpr bool operator==(LayoutSize const& other) const = default;
+};
+
+//! @class A declarative tree of rows and columns that carves a region into the bounds of its components.
+//! @note Each node is carved from the region that its earlier siblings left in its parent, using the parent's
+//! `trimFrom*` methods, and fills the parent across its axis. Solved bounds are cached, so a solve only visits
+//! the subtrees whose constraints or area changed. A bound component receives its absolute bounds and is
+//! asked to adjust to its layout whenever they change, and a bound grid is resized to the whole number of
+//! cells that fits its bounds.
+
+class Layout {
+public:
+    using NodeId = std::size_t;
+
+    //! @brief The identifier of the root node, which fills the area given to `solve`.
+
+    static constexpr NodeId root = 0;
+
+    //! @struct Counters describing the most recent solve.
+
+    struct Statistics {
+        std::size_t visited {0};
+        std::size_t solved {0};
+        std::size_t changed {0};
+    };
+
+public:
+    //! @brief Create a layout with a single root node.
+    //! @param cellSize The size of a cell for nodes sized in cells that are not bound to a grid.
+    //! @param direction The axis along which the root node arranges its children.
+
+    explicit Layout(Size<float> const& cellSize = {20.0f, 20.0f}, LayoutDirection direction = LayoutDirection::Column);
+
+public:
+    //! @brief Add a node to the layout.
+    //! @param parent The node that the new node should be carved from.
+    //! @param size The length of the new node along its parent's axis.
+    //! @param direction The axis along which the new node arranges its own children.
+    //! @return The identifier of the new node.
+
+    NodeId add(NodeId parent, LayoutSize size, LayoutDirection direction = LayoutDirection::Column);
+
+    //! @brief Remove the given node and all of its descendants.
+    //! @param node The node to be removed.
+
+    void remove(NodeId node);
+
+public:
+    //! @brief Set the length of the given node along its parent's axis.
+
+    void setSize(NodeId node, LayoutSize size);
+
+    //! @brief Set the axis along which the given node arranges its children.
+
+    void setDirection(NodeId node, LayoutDirection direction);
+
+    //! @brief Set the edge of its parent that the given node is carved from.
+
+    void setAlignment(NodeId node, LayoutAlignment alignment);
+
+    //! @brief Set the space left between consecutive children of the given node.
+
+    void setGap(NodeId node, float gap);
+
+public:
+    //! @brief Bind the given component to the given node, so that it takes the node's bounds.
+    //! @param component The component, which must outlive its binding.
+
+    void bind(NodeId node, Component& component);
+
+    //! @brief Bind the given grid to the given node, so that it fills as many whole cells of the node as it can.
+    //! @param grid The grid, which must outlive its binding.
+
+    void bind(NodeId node, Grid& grid);
+
+    //! @brief Remove the given node's binding, if any.
+
+    void unbind(NodeId node);
+
+public:
+    //! @brief Solve the layout for the given area, updating the bound components whose bounds changed.
+    //! @param area The region that the root node should fill.
+    //! @return The number of nodes whose children were laid out again.
+
+    std::size_t solve(Bounds<float> const& area);
+
+public:
+    //! @brief Get the bounds of the given node as of the most recent solve.
+
+    [[nodiscard]] inline Bounds<float> const& getBounds(NodeId const node) const {
+        return nodes[node].bounds;
+    }
+
+    //! @brief Get the counters describing the most recent solve.
+
+    [[nodiscard]] inline Statistics const& getStatistics() const {
+        return statistics;
+    }
+
+    //! @brief Get the number of nodes in the layout, excluding the root.
+
+    [[nodiscard]] inline std::size_t size() const {
+        return nodes.size() - freeNodes.size() - 1;
+    }
+
+private:
+    struct Node {
+        NodeId parent {root};
+        std::vector<NodeId> children {};
+        LayoutSize size {};
+        LayoutDirection direction {LayoutDirection::Column};
+        LayoutAlignment alignment {LayoutAlignment::Start};
+        float gap {0.0f};
+        Component* component {nullptr};
+        Grid* grid {nullptr};
+        Bounds<float> bounds {};
+        bool isSolved {false};
+        bool needsLayout {true};
+        bool hasDirtyDescendant {false};
+    };
+
+private:
+    void solveNode(NodeId node, Bounds<float> const& area);
+    void solveChildren(NodeId node);
+    void apply(Node const& node) const;
+    void markNeedsLayout(NodeId node);
+    void releaseNode(NodeId node);
+    [[nodiscard]] float getLength(NodeId node, float parentLength, bool isHorizontal) const;
+
+private:
+    Size<float> cellSize;
+    Statistics statistics {};
+
+private:
+    std::vector<Node> nodes;
+    std::vector<NodeId> freeNodes;
+};
+
+}
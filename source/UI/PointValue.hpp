@@ -0,0 +1,100 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <ostream>
+#include <type_traits>
+#include "Point.hpp"
+
+namespace ds::ui {
+
+//! @struct A trivially copyable, constexpr two-component vector representing a point, (x, y).
+//! @note Unlike `Point`, a `PointValue` has no `w` and `h` aliases. When used as a size, `x` is the width
+//! and `y` is the height.
+
+template <typename T>
+struct PointValue {
+    T x {};
+    T y {};
+
+public:
+    //! @brief Create a PointValue from the given Point.
+    //! @param xy The point to be copied.
+
+    static inline PointValue from(Point<T> const& xy) {
+        return {xy.x, xy.y};
+    }
+
+    //! @brief Create a Point using the PointValue's components.
+
+    [[nodiscard]] inline Point<T> toPoint() const {
+        return {x, y};
+    }
+
+public:
+    friend std::ostream& operator<<(std::ostream& stream, PointValue const& xy) {
+        stream << '(' << xy.x << ", " << xy.y << ')';
+        return stream;
+    }
+
+public:
+    constexpr PointValue operator-() const {
+        return {-x, -y};
+    }
+
+public:
+    template <typename K>
+    constexpr PointValue operator+(K const& k) const {
+        static_assert(std::is_arithmetic_v<K>);
+        return {x + static_cast<T>(k), y + static_cast<T>(k)};
+    }
+
+    template <typename K>
+    constexpr PointValue operator-(K const& k) const {
+        static_assert(std::is_arithmetic_v<K>);
+        return {x - static_cast<T>(k), y - static_cast<T>(k)};
+    }
+
+    template <typename K>
+    constexpr PointValue operator*(K const& k) const {
+        static_assert(std::is_arithmetic_v<K>);
+        return {x * static_cast<T>(k), y * static_cast<T>(k)};
+    }
+
+    template <typename K>
+    constexpr PointValue operator/(K const& k) const {
+        static_assert(std::is_arithmetic_v<K>);
+        return {x / static_cast<T>(k), y / static_cast<T>(k)};
+    }
+
+public:
+    constexpr PointValue operator+(PointValue const& other) const {
+        return {x + other.x, y + other.y};
+    }
+
+    constexpr PointValue operator-(PointValue const& other) const {
+        return {x - other.x, y - other.y};
+    }
+
+    constexpr PointValue operator*(PointValue const& other) const {
+        return {x * other.x, y * other.y};
+    }
+
+    constexpr PointValue operator/(PointValue const& other) const {
+        return {x / other.x, y / other.y};
+    }
+
+public:
+    constexpr bool operator==(PointValue const& other) const = default;
+};
+
+//! @struct A trivially copyable, constexpr two-component vector representing a size, (x, y).
+
+template <typename T>
+using SizeValue = PointValue<T>;
+
+static_assert(std::is_trivially_copyable_v<PointValue<float>> and std::is_standard_layout_v<PointValue<float>>);
+static_assert(sizeof(PointValue<float>) == 2 * sizeof(float));
+
+}
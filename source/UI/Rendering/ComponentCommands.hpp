@@ -0,0 +1,156 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <utility>
+#include <UI/Point.hpp>
+#include <UI/Geometry/GridCulling.hpp>
+#include <UI/Geometry/GridCoverage.hpp>
+#include "Renderer.hpp"
+
+//! @note Components create their graphics resources with `cinder::gl` when they are initialised, so they cannot be
+//! constructed without a graphics context. The command sequences that they issue each frame are kept here, free of
+//! Cinder types, so that a `RecordingRenderer` can record exactly what the components draw.
+
+namespace ds::ui::commands {
+
+//! @struct The parts of a button's state that decide which of its fills are drawn.
+
+struct ButtonFillState {
+    bool isPressed {false};
+    bool isHovering {false};
+    bool isBeingPressed {false};
+};
+
+//! @brief Issue the commands with which `Button` draws its fills.
+//! @param renderer The renderer that should receive the commands.
+//! @param fill The batch that fills the button.
+//! @param offset The offset at which the button is drawn.
+//! @param origin The button's origin.
+//! @param activeColour The colour of the fill of a pressed button.
+//! @param state The button's state.
+
+inline void drawButtonFills(Renderer& renderer, RenderResource const fill, Point<float> const& offset,
+                            Point<float> const& origin, Colour const& activeColour, ButtonFillState const& state) {
+    if (not(state.isPressed or state.isHovering or state.isBeingPressed)) {
+        return;
+    }
+
+    renderer.pushTransform();
+    renderer.translate(offset.x, offset.y);
+    renderer.translate(origin.x, origin.y);
+
+    if (state.isPressed) {
+        renderer.colour(activeColour);
+        renderer.drawBatch(fill);
+    }
+
+    if (state.isHovering) {
+        renderer.colour({1.0f, 1.0f, 1.0f, state.isBeingPressed ? 0.50f : 0.30f});
+        renderer.drawBatch(fill);
+    }
+
+    renderer.popTransform();
+}
+
+//! @struct The uniforms of the grid lines program with which `RuledGrid` and `GridOutline` draw their rules.
+
+struct RuleUniforms {
+    float lineThickness {1.0f};
+    Size<float> viewportScale {};
+    Size<float> spacing {};
+    Size<int> dimensions {};
+};
+
+//! @brief Issue the commands with which `RuledGrid` frames the drawing of its rules.
+//! @param renderer The renderer that should receive the commands.
+//! @param rules The batch holding the grid's rules, whose program receives the uniforms.
+//! @param offset The offset at which the grid is drawn.
+//! @param origin The grid's origin.
+//! @param uniforms The uniforms with which the rules are drawn.
+//! @param drawRules A function that issues the commands that draw the grid's rules.
+
+template <typename DrawRules>
+inline void drawRuledGrid(Renderer& renderer, RenderResource const rules, Point<float> const& offset,
+                          Point<float> const& origin, RuleUniforms const& uniforms, DrawRules&& drawRules) {
+    renderer.pushTransform();
+    renderer.translate(offset.x, offset.y);
+    renderer.translate(origin.x, origin.y);
+    renderer.colour({1.0f, 1.0f, 1.0f});
+
+    renderer.uniform(rules, "LineThickness", uniforms.lineThickness);
+    renderer.uniform(rules, "ViewportScale", {uniforms.viewportScale.w, uniforms.viewportScale.h});
+    renderer.uniform(rules, "gridSpacing", {uniforms.spacing.w, uniforms.spacing.h});
+    renderer.uniform(rules, "gridDimensions", {static_cast<float>(uniforms.dimensions.w),
+                                               static_cast<float>(uniforms.dimensions.h)});
+
+    std::forward<DrawRules>(drawRules)();
+
+    renderer.popTransform();
+}
+
+//! @brief Issue the commands with which `DotGrid` draws the cells that overlap its viewport.
+//! @param renderer The renderer that should receive the commands.
+//! @param cells The batch holding a single cell, which is drawn once for each visible cell.
+//! @param position The position of the grid's origin, including the offset at which it is drawn.
+//! @param spacing The size of each of the grid's cells.
+//! @param visibleCells The range of cells that overlap the viewport.
+//! @param radius The radius of each cell's dot.
+
+inline void drawDotGrid(Renderer& renderer, RenderResource const cells, Point<float> const& position,
+                        Size<float> const& spacing, CellRange const& visibleCells, float const radius) {
+    if (visibleCells.isEmpty()) {
+        return;
+    }
+
+    renderer.pushTransform();
+    renderer.translate(position.x, position.y);
+    renderer.colour({1.0f, 1.0f, 1.0f});
+
+    renderer.uniform(cells, "gridSpacing", {spacing.w, spacing.h});
+    renderer.uniform(cells, "gridFirstCell", {visibleCells.column, visibleCells.row});
+    renderer.uniform(cells, "gridColumns", visibleCells.columns);
+    renderer.uniform(cells, "cellRadius", radius);
+    renderer.drawInstanced(cells, visibleCells.count());
+
+    renderer.popTransform();
+}
+
+//! @brief Issue the commands with which `AnalyticGrid` draws its lines over a single quad.
+//! @param renderer The renderer that should receive the commands.
+//! @param quad The batch holding the unit quad that the grid's lines are computed over.
+//! @param offset The offset at which the grid is drawn.
+//! @param origin The grid's origin.
+//! @param spacing The size of each of the grid's cells.
+//! @param dimensions The grid's number of columns (x) and rows (y).
+//! @param halfThickness Half of the thickness of each line.
+
+inline void drawAnalyticGrid(Renderer& renderer, RenderResource const quad, Point<float> const& offset,
+                             Point<float> const& origin, Size<float> const& spacing, Size<int> const& dimensions,
+                             float const halfThickness) {
+    auto const extent = getGridLineExtent(spacing, dimensions, halfThickness);
+
+    renderer.pushTransform();
+    renderer.translate(offset.x, offset.y);
+    renderer.translate(origin.x, origin.y);
+    renderer.colour({1.0f, 1.0f, 1.0f});
+
+    renderer.uniform(quad, "gridExtent", {extent.origin().x, extent.origin().y, extent.size().w, extent.size().h});
+    renderer.uniform(quad, "gridSpacing", {spacing.w, spacing.h});
+    renderer.uniform(quad, "gridDimensions", {static_cast<float>(dimensions.w), static_cast<float>(dimensions.h)});
+    renderer.uniform(quad, "LineThickness", halfThickness);
+    renderer.drawBatch(quad);
+
+    renderer.popTransform();
+}
+
+//! @brief Issue the commands with which `GridOutline` draws its rules.
+//! @param renderer The renderer that should receive the commands.
+//! @param rules The batch holding the outline's rules.
+
+inline void drawOutlineRules(Renderer& renderer, RenderResource const rules) {
+    renderer.drawBatch(rules);
+}
+
+}
@@ -0,0 +1,130 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "RecordingRenderer.hpp"
+
+#include <algorithm>
+
+namespace ds::ui {
+
+RecordingRenderer::RecordingRenderer(std::size_t const expectedCommands) {
+    commands.reserve(expectedCommands);
+    transforms.reserve(16);
+}
+
+void RecordingRenderer::pushTransform() {
+    record(RenderCommand::Type::PushTransform);
+    transforms.push_back(transform);
+
+    ++stats.transformPushes;
+    stats.maximumDepth = std::max(stats.maximumDepth, transforms.size());
+}
+
+void RecordingRenderer::popTransform() {
+    if (transforms.empty()) {
+        ++stats.unbalancedPops;
+    } else {
+        transform = transforms.back();
+        transforms.pop_back();
+    }
+
+    record(RenderCommand::Type::PopTransform);
+}
+
+void RecordingRenderer::translate(float const x, float const y) {
+    transform.x = transform.x + x * transform.scaleX;
+    transform.y = transform.y + y * transform.scaleY;
+    record(RenderCommand::Type::Translate);
+}
+
+void RecordingRenderer::scale(float const x, float const y) {
+    transform.scaleX = transform.scaleX * x;
+    transform.scaleY = transform.scaleY * y;
+    record(RenderCommand::Type::Scale);
+}
+
+void RecordingRenderer::colour(Colour const& colour) {
+    if (not(colour == currentColour)) {
+        currentColour = colour;
+        ++stats.stateChanges;
+    }
+
+    record(RenderCommand::Type::Colour);
+}
+
+void RecordingRenderer::uniform(RenderResource const batch, char const* const name, UniformValue const& value) {
+    auto& command = record(RenderCommand::Type::Uniform);
+    command.resource = batch;
+    command.name = name;
+    command.value = value;
+
+    ++stats.stateChanges;
+}
+
+void RecordingRenderer::drawBatch(RenderResource const batch,
+                                  int const first,
+                                  int const count,
+                                  RenderResource const texture) {
+    if (texture != nullptr and texture != boundTexture) {
+        boundTexture = texture;
+        ++stats.stateChanges;
+    }
+
+    auto& command = record(RenderCommand::Type::DrawBatch);
+    command.resource = batch;
+    command.texture = texture;
+    command.first = first;
+    command.count = count;
+
+    ++stats.drawCalls;
+}
+
+void RecordingRenderer::drawInstanced(RenderResource const batch, int const instanceCount) {
+    auto& command = record(RenderCommand::Type::DrawInstanced);
+    command.resource = batch;
+    command.count = instanceCount;
+
+    ++stats.drawCalls;
+    stats.instances = stats.instances + static_cast<std::size_t>(std::max(0, instanceCount));
+}
+
+void RecordingRenderer::drawTexture(RenderResource const texture) {
+    if (texture != boundTexture) {
+        boundTexture = texture;
+        ++stats.stateChanges;
+    }
+
+    auto& command = record(RenderCommand::Type::DrawTexture);
+    command.texture = texture;
+
+    ++stats.drawCalls;
+}
+
+void RecordingRenderer::clear() {
+    commands.clear();
+    transforms.clear();
+    transform = {};
+    currentColour = {};
+    boundTexture = nullptr;
+    stats = {};
+}
+
+std::size_t RecordingRenderer::count(RenderCommand::Type const type) const {
+    return static_cast<std::size_t>(std::count_if(commands.begin(), commands.end(), [type](auto const& command) {
+        return command.type == type;
+    }));
+}
+
+RenderCommand& RecordingRenderer::record(RenderCommand::Type const type) {
+    auto& command = commands.emplace_back();
+    command.type = type;
+    command.x = transform.x;
+    command.y = transform.y;
+    command.scaleX = transform.scaleX;
+    command.scaleY = transform.scaleY;
+    command.colour = currentColour;
+
+    return command;
+}
+
+}
@@ -0,0 +1,117 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "Renderer.hpp"
+
+namespace ds::ui {
+
+//! @struct A drawing command recorded by a `RecordingRenderer`.
+//! @note Each command holds the transform and colour that were current when it was issued, so the position of a
+//! draw can be checked without replaying the commands before it.
+
+struct RenderCommand {
+    enum class Type: std::uint8_t {
+        PushTransform, PopTransform, Translate, Scale, Colour, Uniform, DrawBatch, DrawInstanced, DrawTexture
+    };
+
+    Type type {Type::PushTransform};
+    RenderResource resource {nullptr};
+    RenderResource texture {nullptr};
+    int first {0};
+    int count {0};
+    float x {0.0f};
+    float y {0.0f};
+    float scaleX {1.0f};
+    float scaleY {1.0f};
+    Colour colour {};
+    char const* name {nullptr};
+    UniformValue value {};
+};
+
+//! @class A renderer that records each command into a flat buffer instead of drawing it.
+//! @note Install it with a `ScopedRenderer` to count the draw calls, state changes and transform pushes issued
+//! per frame. Components create their resources with `cinder::gl`, so without a graphics context it records the
+//! command sequences of `ComponentCommands.hpp` that the components draw with, rather than the components.
+
+class RecordingRenderer: public Renderer {
+public:
+    //! @struct Counters describing the commands recorded since the renderer was last cleared.
+
+    struct Statistics {
+        std::size_t drawCalls {0};
+        std::size_t instances {0};
+        std::size_t stateChanges {0};
+        std::size_t transformPushes {0};
+        std::size_t maximumDepth {0};
+        std::size_t unbalancedPops {0};
+    };
+
+public:
+    //! @brief Create an empty recording renderer.
+    //! @param expectedCommands The number of commands to reserve space for.
+
+    explicit RecordingRenderer(std::size_t expectedCommands = 1024);
+
+public:
+    void pushTransform() override;
+    void popTransform() override;
+    void translate(float x, float y) override;
+    void scale(float x, float y) override;
+    void colour(Colour const& colour) override;
+    void uniform(RenderResource batch, char const* name, UniformValue const& value) override;
+    void drawBatch(RenderResource batch, int first, int count, RenderResource texture) override;
+    void drawInstanced(RenderResource batch, int instanceCount) override;
+    void drawTexture(RenderResource texture) override;
+
+public:
+    //! @brief Remove every recorded command, reset the counters and restore the identity transform.
+
+    void clear();
+
+    //! @brief Get the recorded commands in the order in which they were issued.
+
+    [[nodiscard]] inline std::vector<RenderCommand> const& getCommands() const {
+        return commands;
+    }
+
+    //! @brief Count the recorded commands of the given type.
+    //! @param type The type of interest.
+
+    [[nodiscard]] std::size_t count(RenderCommand::Type type) const;
+
+    //! @brief Get the renderer's counters.
+
+    [[nodiscard]] inline Statistics const& statistics() const {
+        return stats;
+    }
+
+private:
+    struct Transform {
+        float x {0.0f};
+        float y {0.0f};
+        float scaleX {1.0f};
+        float scaleY {1.0f};
+    };
+
+private:
+    RenderCommand& record(RenderCommand::Type type);
+
+private:
+    std::vector<RenderCommand> commands;
+    std::vector<Transform> transforms;
+
+private:
+    Transform transform {};
+    Colour currentColour {};
+    RenderResource boundTexture {nullptr};
+
+private:
+    Statistics stats {};
+};
+
+}
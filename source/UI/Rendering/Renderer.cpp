@@ -0,0 +1,22 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "Renderer.hpp"
+
+namespace ds::ui {
+
+namespace {
+
+Renderer* installedRenderer = nullptr;
+
+}
+
+Renderer* Renderer::getInstalled() {
+    return installedRenderer;
+}
+
+void Renderer::install(Renderer* const renderer) {
+    installedRenderer = renderer;
+}
+
+}
@@ -0,0 +1,146 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <UI/Colour.hpp>
+
+namespace ds::ui {
+
+//! @brief An opaque handle to a graphics resource, such as a batch or a texture, owned by a component.
+//! @note The handle is the address of the component's reference to the resource, so it is stable for as long
+//! as the component exists, and only the renderer that the resource was created for can interpret it.
+
+using RenderResource = void const*;
+
+//! @struct The value of a shader uniform: a scalar or a vector of up to four floats or integers.
+
+struct UniformValue {
+    enum class Type: std::uint8_t {
+        Float, Int
+    };
+
+    Type type {Type::Float};
+    std::uint8_t size {0};
+    std::array<float, 4> floats {};
+    std::array<int, 4> ints {};
+
+public:
+    UniformValue() = default;
+
+    UniformValue(float const x):
+            type(Type::Float), size(1), floats {x} {
+    }
+
+    UniformValue(float const x, float const y):
+            type(Type::Float), size(2), floats {x, y} {
+    }
+
+    UniformValue(float const x, float const y, float const z, float const w):
+            type(Type::Float), size(4), floats {x, y, z, w} {
+    }
+
+    UniformValue(int const x):
+            type(Type::Int), size(1), ints {x} {
+    }
+
+    UniformValue(int const x, int const y):
+            type(Type::Int), size(2), ints {x, y} {
+    }
+
+    inline bool operator==(UniformValue const& other) const = default;
+};
+
+//! @class An interface through which components issue their drawing commands.
+
+class Renderer {
+public:
+    virtual ~Renderer() = default;
+
+public:
+    //! @brief Save the current transform.
+
+    virtual void pushTransform() = 0;
+
+    //! @brief Restore the most recently saved transform.
+
+    virtual void popTransform() = 0;
+
+    //! @brief Translate the current transform.
+    //! @param x The x component of the desired translation vector.
+    //! @param y The y component of the desired translation vector.
+
+    virtual void translate(float x, float y) = 0;
+
+    //! @brief Scale the current transform.
+    //! @param x The desired horizontal scale factor.
+    //! @param y The desired vertical scale factor.
+
+    virtual void scale(float x, float y) = 0;
+
+    //! @brief Set the current colour.
+    //! @param colour The desired colour.
+
+    virtual void colour(Colour const& colour) = 0;
+
+    //! @brief Set a uniform of the given batch's program for the draws that follow.
+    //! @param batch The batch whose program should receive the uniform.
+    //! @param name The name of the uniform, which must outlive the frame.
+    //! @param value The desired value.
+
+    virtual void uniform(RenderResource batch, char const* name, UniformValue const& value) = 0;
+
+public:
+    //! @brief Draw a range of the given batch's vertices.
+    //! @param batch The batch to be drawn.
+    //! @param first The first vertex to be drawn.
+    //! @param count The number of vertices to be drawn, or -1 to draw every vertex from the first.
+    //! @param texture A texture to be bound for the draw, if any.
+
+    virtual void drawBatch(RenderResource batch, int first = 0, int count = -1, RenderResource texture = nullptr) = 0;
+
+    //! @brief Draw the given number of instances of the given batch.
+    //! @param batch The batch to be drawn.
+    //! @param instanceCount The number of instances to be drawn.
+
+    virtual void drawInstanced(RenderResource batch, int instanceCount) = 0;
+
+    //! @brief Draw the given texture with its upper-left corner at the origin.
+    //! @param texture The texture to be drawn.
+
+    virtual void drawTexture(RenderResource texture) = 0;
+
+public:
+    //! @brief Get the renderer installed in place of the default renderer, if any.
+
+    [[nodiscard]] static Renderer* getInstalled();
+
+    //! @brief Install the given renderer in place of the default renderer, or restore the default renderer.
+    //! @param renderer The desired renderer, or `nullptr`.
+
+    static void install(Renderer* renderer);
+};
+
+//! @class A guard that installs a renderer for as long as it exists.
+
+class ScopedRenderer {
+public:
+    explicit ScopedRenderer(Renderer& renderer):
+            previous(Renderer::getInstalled()) {
+        Renderer::install(&renderer);
+    }
+
+    ~ScopedRenderer() {
+        Renderer::install(previous);
+    }
+
+    ScopedRenderer(ScopedRenderer const&) = delete;
+    ScopedRenderer& operator=(ScopedRenderer const&) = delete;
+
+private:
+    Renderer* previous;
+};
+
+}
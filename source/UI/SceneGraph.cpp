@@ -0,0 +1,190 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#include "SceneGraph.hpp"
+
+#include <limits>
+#include <algorithm>
+
+namespace ds::ui {
+
+namespace {
+
+inline float getArea(Bounds<float> const& bounds) {
+    return bounds.size().w * bounds.size().h;
+}
+
+inline bool isEmpty(Bounds<float> const& bounds) {
+    return bounds.size().w <= 0.0f or bounds.size().h <= 0.0f;
+}
+
+inline bool isEqual(Bounds<float> const& a, Bounds<float> const& b) {
+    return a.origin() == b.origin() and a.size() == b.size();
+}
+
+}
+
+SceneGraph::SceneGraph(Bounds<float> const& viewport, std::size_t const maximumRegions):
+        viewport(viewport),
+        maximumRegions(std::max<std::size_t>(1, maximumRegions)) {
+    nodes.emplace_back();
+    addDamagedRegion(viewport);
+}
+
+SceneGraph::NodeId SceneGraph::add(Component& component, NodeId const parent) {
+    NodeId node;
+    if (freeNodes.empty()) {
+        node = nodes.size();
+        nodes.emplace_back();
+    } else {
+        node = freeNodes.back();
+        freeNodes.pop_back();
+    }
+
+    auto& entry = nodes[node];
+    entry.component = &component;
+    entry.parent = parent;
+
+    nodes[parent].children.push_back(node);
+
+    return node;
+}
+
+void SceneGraph::remove(NodeId const node) {
+    if (node == root or nodes[node].component == nullptr) {
+        return;
+    }
+
+    if (nodes[node].isPlaced) {
+        addDamagedRegion(nodes[node].extent);
+    }
+
+    std::erase(nodes[nodes[node].parent].children, node);
+    releaseNode(node);
+}
+
+void SceneGraph::invalidate(NodeId const node) {
+    nodes[node].isInvalidated = true;
+}
+
+void SceneGraph::setViewport(Bounds<float> const& bounds) {
+    viewport = bounds;
+    addDamagedRegion(viewport);
+}
+
+std::vector<Bounds<float>> const& SceneGraph::update() {
+    updateNode(root, {0.0f, 0.0f});
+
+    dirtyRegions.swap(damagedRegions);
+    damagedRegions.clear();
+    mergeDirtyRegions();
+
+    return dirtyRegions;
+}
+
+void SceneGraph::draw(Bounds<float> const& region) {
+    visit(region, [](Component& component, Point<float> const& offset) {
+        component.draw(offset);
+        component.setShouldRedraw(false);
+    });
+}
+
+void SceneGraph::updateNode(NodeId const node, Point<float> const& offset) {
+    auto& entry = nodes[node];
+    auto bounds = Bounds<float>(offset, {0.0f, 0.0f});
+
+    if (entry.component != nullptr) {
+        bounds = entry.component->withTranslation(offset);
+
+        if (not entry.isPlaced) {
+            addDamagedRegion(bounds);
+        } else if (entry.isInvalidated or entry.component->getShouldRedraw() or not isEqual(bounds, entry.bounds)) {
+            addDamagedRegion(entry.bounds);
+            addDamagedRegion(bounds);
+        }
+
+        entry.bounds = bounds;
+        entry.offset = offset;
+        entry.isPlaced = true;
+        entry.isInvalidated = false;
+    }
+
+    auto extent = bounds;
+    auto isExtentEmpty = entry.component == nullptr;
+
+    for (std::size_t i = 0; i < nodes[node].children.size(); ++i) {
+        auto const child = nodes[node].children[i];
+        updateNode(child, bounds.origin());
+
+        auto const& childExtent = nodes[child].extent;
+        extent = isExtentEmpty ? childExtent : extent.withUnion(childExtent);
+        isExtentEmpty = false;
+    }
+
+    nodes[node].extent = extent;
+}
+
+void SceneGraph::releaseNode(NodeId const node) {
+    for (auto const child: nodes[node].children) {
+        releaseNode(child);
+    }
+
+    nodes[node] = {};
+    freeNodes.push_back(node);
+}
+
+void SceneGraph::addDamagedRegion(Bounds<float> const& region) {
+    auto const clippedRegion = region.withIntersection(viewport);
+    if (not isEmpty(clippedRegion)) {
+        damagedRegions.push_back(clippedRegion);
+    }
+}
+
+void SceneGraph::mergeDirtyRegions() {
+    // Merge each pair of regions whose union is no larger than the two regions combined, since drawing the union
+    // costs no more than drawing the two regions separately.
+
+    auto didMerge = true;
+    while (didMerge) {
+        didMerge = false;
+
+        for (std::size_t i = 0; i < dirtyRegions.size() and not didMerge; ++i) {
+            for (std::size_t j = i + 1; j < dirtyRegions.size(); ++j) {
+                auto const merged = dirtyRegions[i].withUnion(dirtyRegions[j]);
+                if (getArea(merged) <= getArea(dirtyRegions[i]) + getArea(dirtyRegions[j])) {
+                    dirtyRegions[i] = merged;
+                    dirtyRegions[j] = dirtyRegions.back();
+                    dirtyRegions.pop_back();
+                    didMerge = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Then merge the pair whose union adds the least area until there are few enough regions.
+
+    while (dirtyRegions.size() > maximumRegions) {
+        auto bestI = std::size_t {0};
+        auto bestJ = std::size_t {1};
+        auto bestCost = std::numeric_limits<float>::max();
+
+        for (std::size_t i = 0; i < dirtyRegions.size(); ++i) {
+            for (std::size_t j = i + 1; j < dirtyRegions.size(); ++j) {
+                auto const merged = dirtyRegions[i].withUnion(dirtyRegions[j]);
+                auto const cost = getArea(merged) - getArea(dirtyRegions[i]) - getArea(dirtyRegions[j]);
+                if (cost < bestCost) {
+                    bestI = i;
+                    bestJ = j;
+                    bestCost = cost;
+                }
+            }
+        }
+
+        dirtyRegions[bestI] = dirtyRegions[bestI].withUnion(dirtyRegions[bestJ]);
+        dirtyRegions[bestJ] = dirtyRegions.back();
+        dirtyRegions.pop_back();
+    }
+}
+
+}
@@ -0,0 +1,141 @@
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include "Component.hpp"
+
+namespace ds::ui {
+
+//! @class A retained tree of components that tracks which regions of the screen have changed since the last frame.
+//! @note Each component's origin is relative to the origin of its parent. A host should call `update` once per
+//! frame, then scissor and clear each of the returned regions and call `draw` with it, so that only the damaged
+//! regions of the screen are redrawn.
+
+class SceneGraph {
+public:
+    using NodeId = std::size_t;
+
+    //! @brief The identifier of the root node, which has no component and sits at the origin.
+
+    static constexpr NodeId root = 0;
+
+public:
+    //! @brief Create an empty scene graph.
+    //! @param viewport The visible region of the screen, which dirty regions are clipped to.
+    //! @param maximumRegions The maximum number of dirty regions produced by each update.
+
+    explicit SceneGraph(Bounds<float> const& viewport, std::size_t maximumRegions = 8);
+
+public:
+    //! @brief Add the given component to the scene graph.
+    //! @param component The component to be added, which must outlive its membership of the scene graph.
+    //! @param parent The node that the component's origin should be relative to.
+    //! @return The identifier of the new node.
+
+    NodeId add(Component& component, NodeId parent = root);
+
+    //! @brief Remove the given node and all of its descendants from the scene graph.
+    //! @param node The node to be removed.
+
+    void remove(NodeId node);
+
+    //! @brief Indicate that the given node should be redrawn at the next update, even if its bounds are unchanged.
+    //! @param node The node to be redrawn.
+
+    void invalidate(NodeId node);
+
+    //! @brief Set the visible region of the screen, which damages the whole of it.
+    //! @param viewport The desired viewport.
+
+    void setViewport(Bounds<float> const& viewport);
+
+public:
+    //! @brief Find the regions that have changed since the previous update.
+    //! @return A list of merged, non-empty regions within the viewport.
+
+    std::vector<Bounds<float>> const& update();
+
+    //! @brief Draw each component that intersects the given region.
+    //! @param region A region produced by the most recent update.
+
+    void draw(Bounds<float> const& region);
+
+    //! @brief Invoke the given function with each component that intersects the given region and the offset that
+    //! it should be drawn with, skipping each subtree that lies entirely outside the region.
+    //! @param region The region of interest.
+    //! @param visitor A callable with the signature `void(Component&, Point<float> const&)`.
+
+    template <typename Visitor>
+    inline void visit(Bounds<float> const& region, Visitor&& visitor) {
+        visitNode(root, region, visitor);
+    }
+
+public:
+    //! @brief Get the dirty regions produced by the most recent update.
+
+    [[nodiscard]] inline std::vector<Bounds<float>> const& getDirtyRegions() const {
+        return dirtyRegions;
+    }
+
+    //! @brief Get the absolute bounds of the given node as of the most recent update.
+    //! @param node The node of interest.
+
+    [[nodiscard]] inline Bounds<float> const& getAbsoluteBounds(NodeId const node) const {
+        return nodes[node].bounds;
+    }
+
+    //! @brief Get the number of components in the scene graph.
+
+    [[nodiscard]] inline std::size_t size() const {
+        return nodes.size() - freeNodes.size() - 1;
+    }
+
+private:
+    struct Node {
+        Component* component {nullptr};
+        NodeId parent {root};
+        std::vector<NodeId> children {};
+        Bounds<float> bounds {};
+        Bounds<float> extent {};
+        Point<float> offset {};
+        bool isPlaced {false};
+        bool isInvalidated {false};
+    };
+
+private:
+    void updateNode(NodeId node, Point<float> const& offset);
+    void releaseNode(NodeId node);
+    void addDamagedRegion(Bounds<float> const& region);
+    void mergeDirtyRegions();
+
+    template <typename Visitor>
+    inline void visitNode(NodeId const node, Bounds<float> const& region, Visitor& visitor) {
+        auto const& entry = nodes[node];
+        if (not entry.extent.intersects(region)) {
+            return;
+        }
+
+        if (entry.component != nullptr and entry.bounds.intersects(region)) {
+            visitor(*entry.component, entry.offset);
+        }
+
+        for (auto const child: entry.children) {
+            visitNode(child, region, visitor);
+        }
+    }
+
+private:
+    Bounds<float> viewport;
+    std::size_t maximumRegions;
+
+private:
+    std::vector<Node> nodes;
+    std::vector<NodeId> freeNodes;
+    std::vector<Bounds<float>> damagedRegions;
+    std::vector<Bounds<float>> dirtyRegions;
+};
+
+}
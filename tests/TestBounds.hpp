@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <type_traits>
 #include <gtest/gtest.h>
 #include <UI/Bounds.hpp>
 
@@ -121,4 +122,180 @@ TEST(Rectangle, SetPositionWithCentre) {
         EXPECT_EQ(r.centre().x, x);
         EXPECT_EQ(r.centre().y, y);
     }
-}
\ No newline at end of file
+}
+
+//! @note The fixture has external linkage because the classes that `TYPED_TEST` generates derive from it.
+
+template <typename BoundsType>
+class BoundsStorage: public testing::Test {
+};
+
+using BoundsStorageTypes = testing::Types<ds::ui::Bounds<float>, ds::ui::CompactBounds<float>,
+                                          ds::ui::Bounds<int>, ds::ui::CompactBounds<int>>;
+
+TYPED_TEST_SUITE(BoundsStorage, BoundsStorageTypes);
+
+TYPED_TEST(BoundsStorage, DefaultConstructor) {
+    auto const r = TypeParam {};
+
+    EXPECT_EQ(r.size().w, 0);
+    EXPECT_EQ(r.size().h, 0);
+
+    EXPECT_EQ(r.origin().x, 0);
+    EXPECT_EQ(r.origin().y, 0);
+
+    EXPECT_EQ(r.centre().x, 0);
+    EXPECT_EQ(r.centre().y, 0);
+}
+
+TYPED_TEST(BoundsStorage, ParameterisedConstructor) {
+    auto const r = TypeParam {5, 5, 10, 20};
+
+    EXPECT_EQ(r.origin().x, 5);
+    EXPECT_EQ(r.origin().y, 5);
+
+    EXPECT_EQ(r.centre().x, 10);
+    EXPECT_EQ(r.centre().y, 15);
+
+    EXPECT_EQ(r.size().w, 10);
+    EXPECT_EQ(r.size().h, 20);
+}
+
+TYPED_TEST(BoundsStorage, SetSizeFromOrigin) {
+    auto r = TypeParam {10, 10, 0, 0};
+    auto const origin = r.origin();
+    auto const centre = ds::ui::Point(r.centre());
+
+    r.setSizeFromOrigin(10, 20);
+    EXPECT_EQ(r.size().w, 10);
+    EXPECT_EQ(r.size().h, 20);
+    EXPECT_EQ(origin, r.origin());
+    EXPECT_NE(centre, r.centre());
+
+    r.setSizeFromOrigin(0, 0);
+    EXPECT_EQ(r.size().w, 0);
+    EXPECT_EQ(r.size().h, 0);
+    EXPECT_EQ(origin, r.origin());
+    EXPECT_EQ(centre, r.centre());
+
+    r.setPositionWithOrigin(25, 45);
+    r.setSizeFromOrigin(50, 0);
+    EXPECT_EQ(r.size().w, 50);
+    EXPECT_EQ(r.size().h, 0);
+    EXPECT_EQ(r.origin().x, 25);
+    EXPECT_EQ(r.origin().y, 45);
+    EXPECT_EQ(r.centre().x, 50);
+    EXPECT_EQ(r.centre().y, 45);
+}
+
+TYPED_TEST(BoundsStorage, SetSizeFromCentre) {
+    auto r = TypeParam {0, 0, 20, 20};
+    auto const origin = r.origin();
+    auto const centre = ds::ui::Point(r.centre());
+
+    r.setSizeFromCentre(50, 50);
+    EXPECT_EQ(r.size().w, 50);
+    EXPECT_EQ(r.size().h, 50);
+    EXPECT_NE(origin, r.origin());
+    EXPECT_EQ(centre, r.centre());
+
+    r.setSizeFromCentre(0, 0);
+    EXPECT_EQ(r.size().w, 0);
+    EXPECT_EQ(r.size().h, 0);
+    EXPECT_NE(origin, r.origin());
+    EXPECT_EQ(centre, r.centre());
+
+    r.setPositionWithCentre(60, 20);
+    r.setSizeFromCentre(40, 40);
+    EXPECT_EQ(r.size().w, 40);
+    EXPECT_EQ(r.size().h, 40);
+    EXPECT_EQ(r.origin().x, 40);
+    EXPECT_EQ(r.origin().y, 0);
+    EXPECT_EQ(r.centre().x, 60);
+    EXPECT_EQ(r.centre().y, 20);
+}
+
+TYPED_TEST(BoundsStorage, SetPositionWithOrigin) {
+    using Coordinate = std::remove_cvref_t<decltype(TypeParam().origin().x)>;
+    auto r = TypeParam {};
+
+    for (auto i = 0; i < 25; ++i) {
+        auto random = testing::internal::Random(i);
+        auto const x = static_cast<Coordinate>(random.Generate(25e3) - 10e3);
+        auto const y = static_cast<Coordinate>(random.Generate(25e3) - 10e3);
+        r.setPositionWithOrigin(x, y);
+        EXPECT_EQ(r.origin().x, x);
+        EXPECT_EQ(r.origin().y, y);
+
+        auto const xy = ds::ui::Point<Coordinate>(x, y);
+        r.setPositionWithOrigin(xy);
+        EXPECT_EQ(r.origin().x, x);
+        EXPECT_EQ(r.origin().y, y);
+    }
+}
+
+TYPED_TEST(BoundsStorage, SetPositionWithCentre) {
+    using Coordinate = std::remove_cvref_t<decltype(TypeParam().origin().x)>;
+    auto r = TypeParam {};
+
+    for (auto i = 0; i < 25; ++i) {
+        auto random = testing::internal::Random(i);
+        auto x = static_cast<Coordinate>(random.Generate(25e3) - 10e3);
+        auto y = static_cast<Coordinate>(random.Generate(25e3) - 10e3);
+        r.setPositionWithCentre(x, y);
+        EXPECT_EQ(r.centre().x, x);
+        EXPECT_EQ(r.centre().y, y);
+
+        auto const xy = ds::ui::Point {x, y};
+        r.setPositionWithCentre(xy);
+        EXPECT_EQ(r.centre().x, x);
+        EXPECT_EQ(r.centre().y, y);
+    }
+}
+
+TEST(CompactRectangle, MatchesCachedRectangle) {
+    for (auto i = 0; i < 25; ++i) {
+        auto random = testing::internal::Random(i);
+        auto const x = static_cast<int>(random.Generate(25e3) - 10e3);
+        auto const y = static_cast<int>(random.Generate(25e3) - 10e3);
+        auto const w = static_cast<int>(random.Generate(501));
+        auto const h = static_cast<int>(random.Generate(501));
+
+        auto cached = ds::ui::Bounds<int> {x, y, w, h};
+        auto compact = ds::ui::CompactBounds<int> {x, y, w, h};
+
+        cached.setSizeFromCentre(w + 3, h + 7);
+        compact.setSizeFromCentre(w + 3, h + 7);
+        cached.translate(-x, y);
+        compact.translate(-x, y);
+
+        auto const a = cached.trimFromLeft(w / 3);
+        auto const b = compact.trimFromLeft(w / 3);
+
+        EXPECT_EQ(cached.origin(), compact.origin());
+        EXPECT_EQ(cached.centre(), compact.centre());
+        EXPECT_EQ(cached.size(), compact.size());
+        EXPECT_EQ(a.origin(), b.origin());
+        EXPECT_EQ(a.centre(), b.centre());
+    }
+}
+
+TEST(Rectangle, IntersectionAndUnion) {
+    auto const a = ds::ui::Bounds<int> {0, 0, 10, 10};
+    auto const b = ds::ui::Bounds<int> {5, 5, 10, 10};
+    auto const c = ds::ui::CompactBounds<int> {20, 0, 5, 5};
+
+    EXPECT_TRUE(a.intersects(b));
+    EXPECT_FALSE(a.intersects(c));
+
+    auto const shared = a.withIntersection(b);
+    EXPECT_EQ(shared.origin(), ds::ui::Point<int>(5, 5));
+    EXPECT_EQ(shared.size(), ds::ui::Size<int>(5, 5));
+
+    auto const united = a.withUnion(c);
+    EXPECT_EQ(united.origin(), ds::ui::Point<int>(0, 0));
+    EXPECT_EQ(united.size(), ds::ui::Size<int>(25, 10));
+
+    auto const disjoint = a.withIntersection(c);
+    EXPECT_EQ(disjoint.size(), ds::ui::Size<int>(0, 0));
+}
@@ -0,0 +1,134 @@
+//! @file TestBoundsBatch.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <UI/BoundsBatch.hpp>
+
+namespace {
+
+template <typename T>
+std::vector<T> makeBatchCoordinates(int const seed, std::size_t const count) {
+    auto random = testing::internal::Random(seed);
+    std::vector<T> coordinates;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        coordinates.push_back(static_cast<T>(static_cast<int>(random.Generate(400)) - 100));
+    }
+
+    return coordinates;
+}
+
+}
+
+TEST(BoundsBatch, PointsInBoundsMatchScalar) {
+    for (auto const count: {0, 1, 3, 4, 7, 8, 63, 64, 65, 1000}) {
+        auto const n = static_cast<std::size_t>(count);
+        auto const fx = makeBatchCoordinates<float>(count, n);
+        auto const fy = makeBatchCoordinates<float>(count + 1, n);
+        auto const ix = makeBatchCoordinates<std::int32_t>(count, n);
+        auto const iy = makeBatchCoordinates<std::int32_t>(count + 1, n);
+
+        auto const floatBounds = ds::ui::Bounds<float> {-10.0f, 5.0f, 150.5f, 100.0f};
+        auto const intBounds = ds::ui::Bounds<int> {-10, 5, 150, 100};
+
+        std::vector<std::uint64_t> simd(ds::ui::getMaskWordCount(n));
+        std::vector<std::uint64_t> scalar(ds::ui::getMaskWordCount(n));
+
+        ds::ui::containsEach(floatBounds, ds::ui::PointSpan<float> {fx, fy}, simd);
+        ds::ui::scalar::containsEach(floatBounds, ds::ui::PointSpan<float> {fx, fy}, scalar);
+        EXPECT_EQ(simd, scalar);
+
+        ds::ui::containsEach(intBounds, ds::ui::PointSpan<std::int32_t> {ix, iy}, simd);
+        ds::ui::scalar::containsEach(intBounds, ds::ui::PointSpan<std::int32_t> {ix, iy}, scalar);
+        EXPECT_EQ(simd, scalar);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            auto const bit = (simd[i / 64] >> (i % 64)) & 1u;
+            EXPECT_EQ(bit == 1u, intBounds.contains(ds::ui::Point {ix[i], iy[i]}));
+        }
+    }
+}
+
+TEST(BoundsBatch, PointInEachBoundsMatchesScalar) {
+    for (auto const count: {1, 5, 8, 64, 129}) {
+        auto const n = static_cast<std::size_t>(count);
+        auto const x = makeBatchCoordinates<float>(count, n);
+        auto const y = makeBatchCoordinates<float>(count + 1, n);
+        auto const w = makeBatchCoordinates<float>(count + 2, n);
+        auto const h = makeBatchCoordinates<float>(count + 3, n);
+        auto const bounds = ds::ui::BoundsSpan<float> {x, y, w, h};
+
+        std::vector<std::uint64_t> simd(ds::ui::getMaskWordCount(n));
+        std::vector<std::uint64_t> scalar(ds::ui::getMaskWordCount(n));
+
+        for (auto const& point: {ds::ui::Point {0.0f, 0.0f}, ds::ui::Point {50.0f, 20.0f}, ds::ui::Point {x[0], y[0]}}) {
+            ds::ui::containedByEach(point, bounds, simd);
+            ds::ui::scalar::containedByEach(point, bounds, scalar);
+            EXPECT_EQ(simd, scalar);
+        }
+    }
+}
+
+TEST(BoundsBatch, PointInEachIntegralBoundsMatchesScalar) {
+    for (auto const count: {1, 3, 4, 5, 7, 8, 9, 64, 129}) {
+        auto const n = static_cast<std::size_t>(count);
+        auto const x = makeBatchCoordinates<std::int32_t>(count, n);
+        auto const y = makeBatchCoordinates<std::int32_t>(count + 1, n);
+        auto w = makeBatchCoordinates<std::int32_t>(count + 2, n);
+        auto h = makeBatchCoordinates<std::int32_t>(count + 3, n);
+        std::ranges::transform(w, w.begin(), [](std::int32_t const value) { return std::abs(value); });
+        std::ranges::transform(h, h.begin(), [](std::int32_t const value) { return std::abs(value); });
+        auto const bounds = ds::ui::BoundsSpan<std::int32_t> {x, y, w, h};
+
+        std::vector<std::uint64_t> simd(ds::ui::getMaskWordCount(n));
+        std::vector<std::uint64_t> scalar(ds::ui::getMaskWordCount(n));
+
+        auto const px = makeBatchCoordinates<std::int32_t>(count + 4, 32);
+        auto const py = makeBatchCoordinates<std::int32_t>(count + 5, 32);
+
+        for (std::size_t i = 0; i < px.size(); ++i) {
+            auto const point = ds::ui::Point<std::int32_t> {px[i], py[i]};
+            ds::ui::containedByEach(point, bounds, simd);
+            ds::ui::scalar::containedByEach(point, bounds, scalar);
+            EXPECT_EQ(simd, scalar);
+        }
+
+        // Each bounds' own origin and far corner lie on its edges, so they exercise the inclusive comparisons.
+
+        for (auto const& point: {ds::ui::Point {x[n - 1], y[n - 1]}, ds::ui::Point {x[0] + w[0], y[0] + h[0]}}) {
+            ds::ui::containedByEach(point, bounds, simd);
+            ds::ui::scalar::containedByEach(point, bounds, scalar);
+            EXPECT_EQ(simd, scalar);
+            EXPECT_NE(simd, std::vector<std::uint64_t>(simd.size()));
+        }
+    }
+}
+
+TEST(BoundsBatch, ContainsEdges) {
+    std::vector<float> const x {0.0f, 10.0f, 10.0f, 10.001f, -0.001f, 5.0f, 5.0f, 5.0f};
+    std::vector<float> const y {0.0f, 10.0f, 0.0f, 5.0f, 5.0f, 10.0f, 10.001f, 5.0f};
+    std::vector<std::uint64_t> mask(1);
+
+    ds::ui::containsEach(ds::ui::Bounds<float> {0.0f, 0.0f, 10.0f, 10.0f}, ds::ui::PointSpan<float> {x, y}, mask);
+    EXPECT_EQ(mask[0], 0b10100111u);
+}
+
+TEST(BoundsBatch, PointArithmetic) {
+    std::vector<int> x {1, 2, 3, 4, 5};
+    std::vector<int> y {6, 7, 8, 9, 10};
+
+    ds::ui::translateEach<int>(x, y, {10, -10});
+    EXPECT_EQ(x, (std::vector<int> {11, 12, 13, 14, 15}));
+    EXPECT_EQ(y, (std::vector<int> {-4, -3, -2, -1, 0}));
+
+    ds::ui::scaleEach<int>(x, y, {2, 3});
+    EXPECT_EQ(x, (std::vector<int> {22, 24, 26, 28, 30}));
+    EXPECT_EQ(y, (std::vector<int> {-12, -9, -6, -3, 0}));
+}
@@ -0,0 +1,88 @@
+//! @file TestBoundsValue.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <UI/BoundsValue.hpp>
+
+namespace {
+
+constexpr std::array<ds::ui::BoundsValue<int>, 3> makeStaticLayout() {
+    auto area = ds::ui::BoundsValue<int> {0, 0, 400, 300};
+    auto const header = area.trimFromTop(40);
+    auto const sidebar = area.trimFromLeft(100);
+
+    return {header, sidebar, area};
+}
+
+}
+
+TEST(BoundsValue, CompileTimeLayout) {
+    constexpr auto layout = makeStaticLayout();
+
+    static_assert(layout[0] == ds::ui::BoundsValue<int> {0, 0, 400, 40});
+    static_assert(layout[1] == ds::ui::BoundsValue<int> {0, 40, 100, 260});
+    static_assert(layout[2] == ds::ui::BoundsValue<int> {100, 40, 300, 260});
+    static_assert(layout[2].centre() == ds::ui::PointValue<int> {250, 170});
+    static_assert(layout[2].contains(ds::ui::PointValue<int> {100, 300}));
+    static_assert(not layout[2].contains(ds::ui::PointValue<int> {99, 300}));
+
+    static_assert(sizeof(ds::ui::BoundsValue<float>) < sizeof(ds::ui::Bounds<float>));
+    static_assert(std::is_trivially_copyable_v<ds::ui::BoundsValue<int>>);
+
+    std::array<ds::ui::BoundsValue<int>, 3> copy {};
+    std::memcpy(copy.data(), layout.data(), sizeof(layout));
+    EXPECT_EQ(copy, layout);
+}
+
+TEST(BoundsValue, HalvesIntegralSizesAboutTheCentre) {
+    constexpr auto bounds = ds::ui::BoundsValue<int> {10, 20, 40, 30};
+    static_assert(bounds.centre() == ds::ui::PointValue<int> {30, 35});
+
+    constexpr auto resized = bounds.withSizeFromCentre(20, 10);
+    static_assert(resized == ds::ui::BoundsValue<int> {20, 30, 20, 10});
+    static_assert(resized.centre() == bounds.centre());
+
+    auto moved = ds::ui::BoundsValue<int> {0, 0, 9, 5};
+    moved.setPositionWithCentre(100, 50);
+    EXPECT_EQ(moved.origin(), (ds::ui::PointValue<int> {96, 48}));
+    EXPECT_EQ(moved.centre(), (ds::ui::PointValue<int> {100, 50}));
+
+    moved.setPositionWithOrigin(0, 0);
+    EXPECT_EQ(moved.centre(), (ds::ui::PointValue<int> {4, 2}));
+}
+
+TEST(BoundsValue, MatchesBounds) {
+    for (auto i = 0; i < 25; ++i) {
+        auto random = testing::internal::Random(i);
+        auto const x = static_cast<float>(random.Generate(25e3) - 10e3);
+        auto const y = static_cast<float>(random.Generate(25e3) - 10e3);
+        auto const w = static_cast<float>(random.Generate(500));
+        auto const h = static_cast<float>(random.Generate(500));
+        auto const k = static_cast<float>(random.Generate(50));
+
+        auto bounds = ds::ui::Bounds<float> {x, y, w, h};
+        auto value = ds::ui::BoundsValue<float> {x, y, w, h};
+        EXPECT_EQ(value, ds::ui::BoundsValue<float>(bounds));
+
+        bounds.setSizeFromCentre(w + k, h - k);
+        value.setSizeFromCentre(w + k, h - k);
+        EXPECT_EQ(value, ds::ui::BoundsValue<float>(bounds));
+
+        EXPECT_EQ(value.trimFromTop(k), ds::ui::BoundsValue<float>(bounds.trimFromTop(k)));
+        EXPECT_EQ(value.trimFromLeft(k), ds::ui::BoundsValue<float>(bounds.trimFromLeft(k)));
+        EXPECT_EQ(value.trimFromRight(k), ds::ui::BoundsValue<float>(bounds.trimFromRight(k)));
+        EXPECT_EQ(value.trimFromBottom(k), ds::ui::BoundsValue<float>(bounds.trimFromBottom(k)));
+        EXPECT_EQ(value.withTranslation(k, -k), ds::ui::BoundsValue<float>(bounds.withTranslation(k, -k)));
+        EXPECT_EQ(value.withSizeFromCentre(k, k), ds::ui::BoundsValue<float>(bounds.withSizeFromCentre(k, k)));
+        EXPECT_EQ(value, ds::ui::BoundsValue<float>(bounds));
+
+        auto const converted = value.toBounds();
+        EXPECT_EQ(converted.origin(), bounds.origin());
+        EXPECT_EQ(converted.size(), bounds.size());
+    }
+}
@@ -0,0 +1,71 @@
+//! @file TestButtonInstances.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <UI/Geometry/ButtonInstances.hpp>
+
+namespace {
+
+void expectQuad(ds::ui::QuadInstance const& quad, float x, float y, float width, float height, float alpha) {
+    EXPECT_FLOAT_EQ(quad.x, x);
+    EXPECT_FLOAT_EQ(quad.y, y);
+    EXPECT_FLOAT_EQ(quad.w, width);
+    EXPECT_FLOAT_EQ(quad.h, height);
+    EXPECT_FLOAT_EQ(quad.colour.a, alpha);
+}
+
+}
+
+TEST(ButtonInstances, IdleButtonContributesOnlyItsOutline) {
+    auto instances = ds::ui::ButtonInstances({0.0f, 0.0f, 800.0f, 600.0f});
+    auto const button = ds::ui::Bounds<float>(10.0f, 20.0f, 40.0f, 20.0f);
+
+    EXPECT_TRUE(instances.add(button, {5.0f, 5.0f}, {false, false, false, {}, 2.0f}));
+
+    auto const& quads = instances.getInstances();
+    ASSERT_EQ(quads.size(), 4);
+    expectQuad(quads[0], 14.0f, 24.0f, 42.0f, 2.0f, 1.0f);
+    expectQuad(quads[1], 14.0f, 44.0f, 42.0f, 2.0f, 1.0f);
+    expectQuad(quads[2], 14.0f, 24.0f, 2.0f, 22.0f, 1.0f);
+    expectQuad(quads[3], 54.0f, 24.0f, 2.0f, 22.0f, 1.0f);
+}
+
+TEST(ButtonInstances, FillsPrecedeOutlineInDrawOrder) {
+    auto instances = ds::ui::ButtonInstances({0.0f, 0.0f, 800.0f, 600.0f});
+    auto const button = ds::ui::Bounds<float>(0.0f, 0.0f, 40.0f, 20.0f);
+    auto const active = ds::ui::Colour {0.3f, 0.8f, 0.6f, 1.0f};
+
+    instances.add(button, {0.0f, 0.0f}, {true, true, true, active, 1.0f});
+
+    auto const& quads = instances.getInstances();
+    ASSERT_EQ(quads.size(), 6);
+    expectQuad(quads[0], 0.0f, 0.0f, 40.0f, 20.0f, 1.0f);
+    EXPECT_FLOAT_EQ(quads[0].colour.g, 0.8f);
+    expectQuad(quads[1], 0.0f, 0.0f, 40.0f, 20.0f, 0.5f);
+
+    instances.clear();
+    instances.add(button, {0.0f, 0.0f}, {false, true, false, active, 1.0f});
+
+    ASSERT_EQ(instances.getInstances().size(), 5);
+    expectQuad(instances.getInstances()[0], 0.0f, 0.0f, 40.0f, 20.0f, 0.3f);
+}
+
+TEST(ButtonInstances, CullsButtonsOutsideTheViewport) {
+    auto instances = ds::ui::ButtonInstances({0.0f, 0.0f, 100.0f, 100.0f});
+
+    for (auto i = 0; i < 20; ++i) {
+        auto const x = static_cast<float>(i) * 20.0f;
+        instances.add({x, 10.0f, 10.0f, 10.0f}, {0.0f, 0.0f}, {});
+    }
+
+    EXPECT_EQ(instances.getButtonCount(), 6);
+    EXPECT_EQ(instances.getCulledCount(), 14);
+    EXPECT_EQ(instances.getInstances().size(), 24);
+
+    instances.clear();
+    EXPECT_EQ(instances.getButtonCount(), 0);
+    EXPECT_TRUE(instances.getInstances().empty());
+}
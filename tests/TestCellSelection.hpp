@@ -0,0 +1,175 @@
+//! @file TestCellSelection.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <random>
+#include <gtest/gtest.h>
+#include <UI/Constructs/CellSelection.hpp>
+
+namespace {
+
+//! @brief A cell-by-cell model of a selection, against which a `CellSelection` can be checked.
+
+struct ReferenceSelection {
+    ReferenceSelection(int const rows, int const columns):
+            rows(rows), columns(columns), cells(static_cast<std::size_t>(rows * columns), false) {
+    }
+
+    template <typename Operation>
+    void apply(ds::ui::Bounds<int> const& rectangle, Operation&& operation) {
+        for (auto row = 0; row < rows; ++row) {
+            for (auto column = 0; column < columns; ++column) {
+                auto const isInside = column >= rectangle.origin().x and row >= rectangle.origin().y and
+                                      column < rectangle.origin().x + rectangle.size().w and
+                                      row < rectangle.origin().y + rectangle.size().h;
+
+                auto&& cell = cells[static_cast<std::size_t>(row * columns + column)];
+                cell = operation(cell, isInside);
+            }
+        }
+    }
+
+    int rows;
+    int columns;
+    std::vector<bool> cells;
+};
+
+void expectMatchesReference(ds::ui::CellSelection const& selection, ReferenceSelection const& reference) {
+    auto expectedCount = std::size_t {0};
+    for (auto row = 0; row < reference.rows; ++row) {
+        for (auto column = 0; column < reference.columns; ++column) {
+            auto const expected = reference.cells[static_cast<std::size_t>(row * reference.columns + column)];
+            expectedCount = expectedCount + (expected ? 1 : 0);
+            ASSERT_EQ(selection.contains({column, row}), expected) << "(" << column << ", " << row << ")";
+        }
+    }
+
+    EXPECT_EQ(selection.count(), expectedCount);
+
+    auto visited = std::size_t {0};
+    selection.forEach([&](ds::ui::Point<int> const& cell) {
+        EXPECT_TRUE(reference.cells[static_cast<std::size_t>(cell.y * reference.columns + cell.x)]);
+        visited = visited + 1;
+    });
+
+    auto inRuns = std::size_t {0};
+    selection.forEachRun([&](int const row, int const column, int const length) {
+        for (auto x = column; x < column + length; ++x) {
+            EXPECT_TRUE(reference.cells[static_cast<std::size_t>(row * reference.columns + x)]);
+        }
+
+        inRuns = inRuns + static_cast<std::size_t>(length);
+    });
+
+    EXPECT_EQ(visited, expectedCount);
+    EXPECT_EQ(inRuns, expectedCount);
+}
+
+}
+
+TEST(CellSelection, StoresAMarqueeAsASingleRectangle) {
+    auto selection = ds::ui::CellSelection(100, 100);
+
+    selection.select({10, 20, 5, 3});
+    EXPECT_TRUE(selection.isSingleRectangle());
+    EXPECT_EQ(selection.count(), 15);
+    EXPECT_TRUE(selection.contains({14, 22}));
+    EXPECT_FALSE(selection.contains({15, 22}));
+
+    selection.add({11, 21, 2, 1});
+    selection.intersect({12, 0, 100, 100});
+    EXPECT_TRUE(selection.isSingleRectangle());
+    EXPECT_EQ(selection.count(), 9);
+
+    selection.select({90, 90, 50, 50});
+    EXPECT_EQ(selection.count(), 100);
+
+    selection.subtract({0, 0, 100, 100});
+    EXPECT_TRUE(selection.empty());
+    EXPECT_TRUE(selection.isSingleRectangle());
+}
+
+TEST(CellSelection, CombinesRectanglesAcrossWordBoundaries) {
+    auto selection = ds::ui::CellSelection(40, 200);
+    auto reference = ReferenceSelection(40, 200);
+
+    auto const add = [](bool const cell, bool const isInside) { return cell or isInside; };
+    auto const subtract = [](bool const cell, bool const isInside) { return cell and not isInside; };
+    auto const intersect = [](bool const cell, bool const isInside) { return cell and isInside; };
+
+    selection.add({60, 2, 70, 10});
+    reference.apply({60, 2, 70, 10}, add);
+    selection.add({0, 5, 64, 3});
+    reference.apply({0, 5, 64, 3}, add);
+    EXPECT_FALSE(selection.isSingleRectangle());
+    expectMatchesReference(selection, reference);
+
+    selection.subtract({63, 0, 2, 40});
+    reference.apply({63, 0, 2, 40}, subtract);
+    expectMatchesReference(selection, reference);
+
+    selection.intersect({10, 4, 180, 5});
+    reference.apply({10, 4, 180, 5}, intersect);
+    expectMatchesReference(selection, reference);
+
+    auto const bounds = selection.getBounds();
+    EXPECT_EQ(bounds.origin().x, 10);
+    EXPECT_EQ(bounds.origin().y, 4);
+    EXPECT_EQ(bounds.size().w, 120);
+    EXPECT_EQ(bounds.size().h, 5);
+}
+
+TEST(CellSelection, MatchesAReferenceUnderRandomOperations) {
+    auto selection = ds::ui::CellSelection(37, 150);
+    auto reference = ReferenceSelection(37, 150);
+    auto generator = std::mt19937(7);
+    auto coordinate = std::uniform_int_distribution<int>(-10, 160);
+    auto kind = std::uniform_int_distribution<int>(0, 3);
+
+    for (auto i = 0; i < 200; ++i) {
+        auto const x0 = coordinate(generator);
+        auto const y0 = coordinate(generator) / 4;
+        auto const rectangle = ds::ui::Bounds<int>(x0, y0, coordinate(generator) / 2, coordinate(generator) / 8);
+
+        switch (kind(generator)) {
+            case 0:
+                selection.select(rectangle);
+                reference.apply(rectangle, [](bool, bool const isInside) { return isInside; });
+                break;
+            case 1:
+                selection.add(rectangle);
+                reference.apply(rectangle, [](bool const cell, bool const isInside) { return cell or isInside; });
+                break;
+            case 2:
+                selection.subtract(rectangle);
+                reference.apply(rectangle, [](bool const cell, bool const isInside) {
+                    return cell and not isInside;
+                });
+                break;
+            default:
+                selection.intersect(rectangle);
+                reference.apply(rectangle, [](bool const cell, bool const isInside) { return cell and isInside; });
+                break;
+        }
+
+        expectMatchesReference(selection, reference);
+    }
+}
+
+TEST(CellSelection, ClipsRectanglesToTheGrid) {
+    auto selection = ds::ui::CellSelection(10, 10);
+
+    selection.add({-5, -5, 8, 8});
+    selection.add({8, 8, 10, 10});
+
+    EXPECT_EQ(selection.count(), 13);
+    EXPECT_FALSE(selection.contains({-1, 0}));
+    EXPECT_FALSE(selection.contains({10, 9}));
+
+    selection.setDimensions(20, 20);
+    EXPECT_TRUE(selection.empty());
+    EXPECT_EQ(selection.getDimensions().w, 20);
+}
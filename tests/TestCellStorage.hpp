@@ -0,0 +1,122 @@
+//! @file TestCellStorage.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <gtest/gtest.h>
+#include <UI/Components/CellStorage.hpp>
+
+namespace {
+
+using TestCellStorage = ds::ui::CellStorage<int, 64>;
+
+std::vector<std::pair<ds::ui::Point<int>, int>> collectRegion(TestCellStorage const& cells,
+                                                               ds::ui::Bounds<int> const& region) {
+    std::vector<std::pair<ds::ui::Point<int>, int>> visited;
+    cells.forEachInRegion(region, [&visited](ds::ui::Point<int> const& cell, int const value) {
+        visited.emplace_back(cell, value);
+    });
+
+    return visited;
+}
+
+}
+
+TEST(CellStorage, AllocatesOnlyTouchedChunks) {
+    auto cells = TestCellStorage(10000, 10000);
+
+    cells.set({0, 0}, 1);
+    cells.set({63, 63}, 2);
+    cells.set({9999, 9999}, 3);
+    cells.set({10000, 0}, 4);
+    cells.set({-1, 0}, 5);
+
+    EXPECT_EQ(cells.size(), 3);
+    EXPECT_EQ(cells.getChunkCount(), 2);
+    EXPECT_EQ(cells.get({63, 63}), 2);
+    EXPECT_EQ(cells.get({9999, 9999}), 3);
+    EXPECT_EQ(cells.get({5000, 5000}), 0);
+    EXPECT_TRUE(cells.isOccupied({0, 0}));
+    EXPECT_FALSE(cells.isOccupied({1, 0}));
+    EXPECT_FALSE(cells.isOccupied({10000, 0}));
+}
+
+TEST(CellStorage, VisitsOccupiedCellsWithinHalfOpenRegion) {
+    auto cells = TestCellStorage(1000, 1000);
+
+    cells.set({10, 10}, 1);
+    cells.set({64, 10}, 2);
+    cells.set({70, 70}, 3);
+    cells.set({200, 200}, 4);
+
+    auto const visited = collectRegion(cells, {10, 10, 61, 61});
+    ASSERT_EQ(visited.size(), 3);
+    EXPECT_EQ(visited[0].second, 1);
+    EXPECT_EQ(visited[1].second, 2);
+    EXPECT_EQ(visited[2].second, 3);
+
+    EXPECT_EQ(collectRegion(cells, {10, 10, 60, 60}).size(), 2);
+    EXPECT_EQ(collectRegion(cells, {0, 0, 1000, 1000}).size(), 4);
+    EXPECT_EQ(collectRegion(cells, {-100, -100, 111, 111}).size(), 1);
+    EXPECT_TRUE(collectRegion(cells, {10, 10, 0, 5}).empty());
+}
+
+TEST(CellStorage, ReportsEachDirtyChunkOnce) {
+    auto cells = TestCellStorage(1000, 1000);
+    using Chunk = TestCellStorage::ChunkCoordinate;
+
+    cells.set({1, 1}, 1);
+    cells.set({2, 2}, 2);
+    cells.set({130, 1}, 3);
+
+    ASSERT_EQ(cells.getDirtyChunks().size(), 2);
+    EXPECT_EQ(cells.getDirtyChunks()[0], (Chunk {0, 0}));
+    EXPECT_EQ(cells.getDirtyChunks()[1], (Chunk {2, 0}));
+
+    cells.clearDirtyChunks();
+    EXPECT_TRUE(cells.getDirtyChunks().empty());
+
+    cells.erase({130, 1});
+    cells.erase({500, 500});
+    ASSERT_EQ(cells.getDirtyChunks().size(), 1);
+    EXPECT_EQ(cells.getDirtyChunks()[0], (Chunk {2, 0}));
+
+    cells.shrink();
+    EXPECT_EQ(cells.getChunkCount(), 1);
+
+    cells.set({131, 1}, 4);
+    EXPECT_EQ(cells.getDirtyChunks().size(), 1);
+}
+
+TEST(CellStorage, ClipsChunkBoundsToTheGrid) {
+    auto const cells = TestCellStorage(100, 150);
+    auto const bounds = cells.getChunkBounds({2, 1});
+
+    EXPECT_EQ(bounds.origin().x, 128);
+    EXPECT_EQ(bounds.origin().y, 64);
+    EXPECT_EQ(bounds.size().w, 22);
+    EXPECT_EQ(bounds.size().h, 36);
+}
+
+TEST(CellStorage, RemovesCellsOutsideShrunkenGrid) {
+    auto cells = TestCellStorage(200, 200);
+
+    cells.set({10, 10}, 1);
+    cells.set({90, 10}, 2);
+    cells.set({150, 150}, 3);
+    cells.clearDirtyChunks();
+
+    cells.setDimensions(100, 80);
+
+    EXPECT_EQ(cells.size(), 1);
+    EXPECT_EQ(cells.getChunkCount(), 1);
+    EXPECT_EQ(cells.get({10, 10}), 1);
+    EXPECT_EQ(cells.getDirtyChunks().size(), 2);
+
+    cells.clear();
+    EXPECT_EQ(cells.size(), 0);
+    EXPECT_EQ(cells.getChunkCount(), 0);
+}
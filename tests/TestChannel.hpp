@@ -0,0 +1,70 @@
+//! @file TestChannel.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <memory>
+#include <gtest/gtest.h>
+#include <Events/Channel.hpp>
+#include <Events/CursorEvent.hpp>
+#include <Events/EventsReceiver.hpp>
+
+namespace {
+
+struct TypedCursorReceiver: public ds::events::ChannelReceiver<TypedCursorReceiver, ds::ui::CursorEvent> {
+    void onEvent(ds::ui::CursorEvent const& event) {
+        lastPosition = event.xy;
+        ++count;
+    }
+
+    ds::ui::Point<int> lastPosition {};
+    int count {0};
+};
+
+struct LegacyCursorReceiver: public ds::events::Receiver<ds::events::EventType::CursorEvent> {
+    void onEvent(ds::events::Event const& event) override {
+        lastPosition = static_cast<ds::ui::CursorEvent const&>(event).xy;
+        ++count;
+    }
+
+    ds::ui::Point<int> lastPosition {};
+    int count {0};
+};
+
+using TypedCursorChannel = ds::events::Channel<ds::ui::CursorEvent, TypedCursorReceiver>;
+using AdaptedCursorChannel = ds::events::Channel<ds::ui::CursorEvent, TypedCursorReceiver,
+                                                 ds::events::ChannelAdapter<ds::ui::CursorEvent>>;
+
+}
+
+TEST(Channel, DeliversToTypedReceivers) {
+    auto receiver = std::make_unique<TypedCursorReceiver>();
+    EXPECT_EQ(TypedCursorChannel::size(), 1);
+
+    TypedCursorChannel::dispatch({{4, 8}, false, false});
+    EXPECT_EQ(receiver->count, 1);
+    EXPECT_EQ(receiver->lastPosition, ds::ui::Point(4, 8));
+
+    receiver.reset();
+    EXPECT_EQ(TypedCursorChannel::size(), 0);
+}
+
+TEST(Channel, AdapterForwardsToLegacyReceivers) {
+    TypedCursorReceiver typed;
+    LegacyCursorReceiver legacy;
+
+    {
+        ds::events::ChannelAdapter<ds::ui::CursorEvent> adapter;
+        EXPECT_EQ(AdaptedCursorChannel::size(), 2);
+
+        AdaptedCursorChannel::dispatch({{15, 16}, true, false});
+        EXPECT_EQ(typed.count, 1);
+        EXPECT_EQ(legacy.count, 1);
+        EXPECT_EQ(legacy.lastPosition, ds::ui::Point(15, 16));
+    }
+
+    AdaptedCursorChannel::dispatch({{23, 42}, false, false});
+    EXPECT_EQ(typed.count, 2);
+    EXPECT_EQ(legacy.count, 1);
+}
@@ -0,0 +1,128 @@
+//! @file TestConcurrentDispatcher.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include <gtest/gtest.h>
+#include <Events/EventsReceiver.hpp>
+#include <Events/ConcurrentDispatcher.hpp>
+
+namespace {
+
+constexpr int ConcurrentTestEvent {1001};
+
+struct CountingReceiver: public ds::events::ReceiverInterface {
+    void onEvent(ds::events::Event const& event) override {
+        count.fetch_add(1);
+    }
+
+    std::atomic<int> count {0};
+};
+
+}
+
+TEST(ConcurrentDispatcher, DeliversToSubscribedReceivers) {
+    CountingReceiver a, b;
+    ds::events::ConcurrentDispatcher::subscribe(ConcurrentTestEvent, &a);
+    ds::events::ConcurrentDispatcher::subscribe(ConcurrentTestEvent, &b);
+
+    ds::events::ConcurrentDispatcher::dispatch(ds::events::Event(ConcurrentTestEvent));
+    EXPECT_EQ(a.count, 1);
+    EXPECT_EQ(b.count, 1);
+
+    ds::events::ConcurrentDispatcher::unsubscribe(ConcurrentTestEvent, &a);
+    ds::events::ConcurrentDispatcher::dispatch(ds::events::Event(ConcurrentTestEvent));
+    EXPECT_EQ(a.count, 1);
+    EXPECT_EQ(b.count, 2);
+
+    ds::events::ConcurrentDispatcher::unsubscribe(ConcurrentTestEvent, &b);
+    ds::events::ConcurrentDispatcher::dispatch(ds::events::Event(ConcurrentTestEvent));
+    EXPECT_EQ(b.count, 2);
+}
+
+TEST(ConcurrentDispatcher, IgnoresUnknownChannels) {
+    CountingReceiver a;
+    ds::events::ConcurrentDispatcher::unsubscribe(ConcurrentTestEvent + 1, &a);
+    ds::events::ConcurrentDispatcher::dispatch(ds::events::Event(ConcurrentTestEvent + 2));
+    EXPECT_EQ(a.count, 0);
+}
+
+TEST(ConcurrentDispatcher, ReceiverAdapter) {
+    struct Adapter: public ds::events::Receiver<ConcurrentTestEvent + 3, ds::events::ConcurrentDispatcher> {
+        void onEvent(ds::events::Event const& event) override {
+            ++count;
+        }
+
+        int count {0};
+    };
+
+    auto receiver = std::make_unique<Adapter>();
+    ds::events::ConcurrentDispatcher::dispatch(ds::events::Event(ConcurrentTestEvent + 3));
+    EXPECT_EQ(receiver->count, 1);
+
+    receiver.reset();
+    ds::events::ConcurrentDispatcher::dispatch(ds::events::Event(ConcurrentTestEvent + 3));
+}
+
+TEST(ConcurrentDispatcher, SubscriptionChurnDuringDispatch) {
+    auto const eventId = ConcurrentTestEvent + 4;
+    CountingReceiver persistent;
+    ds::events::ConcurrentDispatcher::subscribe(eventId, &persistent);
+
+    std::atomic<bool> isRunning {true};
+    std::thread dispatcher([&] {
+        while (isRunning) {
+            ds::events::ConcurrentDispatcher::dispatch(ds::events::Event(eventId));
+        }
+    });
+
+    for (auto i = 0; i < 2000; ++i) {
+        auto transient = std::make_unique<CountingReceiver>();
+        ds::events::ConcurrentDispatcher::subscribe(eventId, transient.get());
+        ds::events::ConcurrentDispatcher::unsubscribe(eventId, transient.get());
+    }
+
+    isRunning = false;
+    dispatcher.join();
+
+    auto const delivered = persistent.count.load();
+    ds::events::ConcurrentDispatcher::dispatch(ds::events::Event(eventId));
+    EXPECT_EQ(persistent.count, delivered + 1);
+
+    ds::events::ConcurrentDispatcher::unsubscribe(eventId, &persistent);
+}
+
+TEST(ConcurrentDispatcher, ReceiverThatThrowsDoesNotBlockSubscription) {
+    struct ThrowingReceiver: public ds::events::ReceiverInterface {
+        void onEvent(ds::events::Event const& event) override {
+            throw std::runtime_error("Receiver failed.");
+        }
+    };
+
+    ThrowingReceiver thrower;
+    CountingReceiver counter;
+    ds::events::ConcurrentDispatcher::subscribe(ConcurrentTestEvent + 4, &thrower);
+
+    EXPECT_THROW(ds::events::ConcurrentDispatcher::dispatch(ds::events::Event(ConcurrentTestEvent + 4)),
+                 std::runtime_error);
+
+    // An update made on another thread waits for every open dispatch, so it would never return if the failed
+    // dispatch were still open.
+
+    auto writer = std::thread([&] {
+        ds::events::ConcurrentDispatcher::unsubscribe(ConcurrentTestEvent + 4, &thrower);
+        ds::events::ConcurrentDispatcher::subscribe(ConcurrentTestEvent + 4, &counter);
+    });
+
+    writer.join();
+    ds::events::ConcurrentDispatcher::dispatch(ds::events::Event(ConcurrentTestEvent + 4));
+    ds::events::ConcurrentDispatcher::unsubscribe(ConcurrentTestEvent + 4, &counter);
+
+    EXPECT_EQ(counter.count, 1);
+}
@@ -0,0 +1,91 @@
+//! @file TestCursorEventQueue.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <gtest/gtest.h>
+#include <Events/CursorEventQueue.hpp>
+
+namespace {
+
+using QueuedCursorEvent = std::pair<ds::ui::CursorAction, ds::ui::Point<int>>;
+
+template <std::size_t Capacity>
+std::vector<QueuedCursorEvent> flushCursorEvents(ds::ui::CursorEventQueue<Capacity>& queue) {
+    std::vector<QueuedCursorEvent> events;
+    queue.flush([&](ds::ui::CursorAction const action, ds::ui::CursorEvent const& event) {
+        events.emplace_back(action, event.xy);
+    });
+
+    return events;
+}
+
+}
+
+TEST(CursorEventQueue, CoalescesConsecutiveMoves) {
+    using ds::ui::CursorAction;
+    auto queue = ds::ui::CursorEventQueue<16> {};
+
+    for (auto i = 0; i < 10; ++i) {
+        EXPECT_TRUE(queue.enqueue(CursorAction::Move, ds::ui::CursorEventData({i, i}, false, false)));
+    }
+
+    EXPECT_EQ(queue.size(), 1);
+
+    auto const events = flushCursorEvents(queue);
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].first, CursorAction::Move);
+    EXPECT_EQ(events[0].second, ds::ui::Point(9, 9));
+
+    EXPECT_EQ(queue.statistics().received, 10);
+    EXPECT_EQ(queue.statistics().coalesced, 9);
+    EXPECT_EQ(queue.statistics().delivered, 1);
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST(CursorEventQueue, PreservesPressesAndReleases) {
+    using ds::ui::CursorAction;
+    auto queue = ds::ui::CursorEventQueue<16> {};
+
+    EXPECT_TRUE(queue.enqueue(CursorAction::Move, ds::ui::CursorEventData({0, 0}, false, false)));
+    EXPECT_TRUE(queue.enqueue(CursorAction::Move, ds::ui::CursorEventData({1, 0}, false, false)));
+    EXPECT_TRUE(queue.enqueue(CursorAction::Down, ds::ui::CursorEventData({1, 0}, true, false)));
+    EXPECT_TRUE(queue.enqueue(CursorAction::Drag, ds::ui::CursorEventData({2, 0}, true, false)));
+    EXPECT_TRUE(queue.enqueue(CursorAction::Drag, ds::ui::CursorEventData({3, 0}, true, false)));
+    EXPECT_TRUE(queue.enqueue(CursorAction::Drag, ds::ui::CursorEventData({4, 0}, true, true)));
+    EXPECT_TRUE(queue.enqueue(CursorAction::Up, ds::ui::CursorEventData({4, 0}, false, false)));
+    EXPECT_TRUE(queue.enqueue(CursorAction::Down, ds::ui::CursorEventData({4, 0}, true, false)));
+    EXPECT_TRUE(queue.enqueue(CursorAction::Down, ds::ui::CursorEventData({4, 0}, true, false)));
+
+    auto const events = flushCursorEvents(queue);
+    auto const expected = std::vector<QueuedCursorEvent> {
+            {CursorAction::Move, {1, 0}},
+            {CursorAction::Down, {1, 0}},
+            {CursorAction::Drag, {3, 0}},
+            {CursorAction::Drag, {4, 0}},
+            {CursorAction::Up,   {4, 0}},
+            {CursorAction::Down, {4, 0}},
+            {CursorAction::Down, {4, 0}}
+    };
+
+    EXPECT_EQ(events, expected);
+    EXPECT_EQ(queue.statistics().coalesced, 2);
+    EXPECT_EQ(queue.statistics().delivered, expected.size());
+}
+
+TEST(CursorEventQueue, RejectsEventsWhenFull) {
+    using ds::ui::CursorAction;
+    auto queue = ds::ui::CursorEventQueue<2> {};
+
+    EXPECT_TRUE(queue.enqueue(CursorAction::Down, ds::ui::CursorEventData({0, 0}, true, false)));
+    EXPECT_TRUE(queue.enqueue(CursorAction::Up, ds::ui::CursorEventData({0, 0}, false, false)));
+    EXPECT_FALSE(queue.enqueue(CursorAction::Down, ds::ui::CursorEventData({0, 0}, true, false)));
+    EXPECT_EQ(queue.statistics().dropped, 1);
+
+    flushCursorEvents(queue);
+    EXPECT_TRUE(queue.enqueue(CursorAction::Down, ds::ui::CursorEventData({0, 0}, true, false)));
+    EXPECT_EQ(flushCursorEvents(queue).size(), 1);
+}
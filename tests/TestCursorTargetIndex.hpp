@@ -0,0 +1,189 @@
+//! @file TestCursorTargetIndex.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <deque>
+#include <stdexcept>
+#include <gtest/gtest.h>
+#include <Events/CursorTargetIndex.hpp>
+
+namespace {
+
+struct IndexedTarget: public ds::ui::Bounds<float>, public ds::ui::CursorTarget {
+    IndexedTarget(float const x, float const y, float const width, float const height):
+            ds::ui::Bounds<float>(x, y, width, height) {
+    }
+
+    [[nodiscard]] bool isCursorInBounds(ds::ui::CursorEvent const& event) const override {
+        return contains(event.xy);
+    }
+
+    void cursorDidEnter(ds::ui::CursorEvent const& event) override {
+        ++enterCount;
+    }
+
+    void cursorDidLeave(ds::ui::CursorEvent const& event) override {
+        ++leaveCount;
+    }
+
+    void targetWasReleased(ds::ui::CursorEvent const& event) override {
+        ++releaseCount;
+    }
+
+    int enterCount {0};
+    int leaveCount {0};
+    int releaseCount {0};
+};
+
+}
+
+TEST(CursorTargetIndex, MatchesExhaustiveRouting) {
+    std::deque<IndexedTarget> indexed;
+    std::deque<IndexedTarget> exhaustive;
+    auto index = ds::ui::CursorTargetIndex(32.0f);
+
+    for (auto i = 0; i < 200; ++i) {
+        auto random = testing::internal::Random(i);
+        auto const x = static_cast<float>(random.Generate(1000)) - 100.0f;
+        auto const y = static_cast<float>(random.Generate(1000)) - 100.0f;
+        auto const w = static_cast<float>(random.Generate(120));
+        auto const h = static_cast<float>(random.Generate(120));
+
+        index.insert(indexed.emplace_back(x, y, w, h));
+        exhaustive.emplace_back(x, y, w, h);
+    }
+
+    auto random = testing::internal::Random(42);
+    for (auto i = 0; i < 2000; ++i) {
+        auto const xy = ds::ui::Point {
+                static_cast<int>(random.Generate(1100)) - 150,
+                static_cast<int>(random.Generate(1100)) - 150
+        };
+
+        auto const event = ds::ui::CursorEvent(xy, false, false);
+        index.route(ds::ui::CursorAction::Move, event);
+
+        for (auto& target: exhaustive) {
+            target.cursorMove(event);
+        }
+    }
+
+    for (std::size_t i = 0; i < indexed.size(); ++i) {
+        EXPECT_EQ(indexed[i].enterCount, exhaustive[i].enterCount);
+        EXPECT_EQ(indexed[i].leaveCount, exhaustive[i].leaveCount);
+        EXPECT_EQ(indexed[i].isCursorHovering(), exhaustive[i].isCursorHovering());
+    }
+}
+
+TEST(CursorTargetIndex, UpdatesAfterTranslation) {
+    auto target = IndexedTarget(0.0f, 0.0f, 10.0f, 10.0f);
+    auto index = ds::ui::CursorTargetIndex(16.0f);
+    index.insert(target);
+
+    target.translate(500.0f, 500.0f);
+    index.update(target);
+
+    index.route(ds::ui::CursorAction::Move, {{5, 5}, false, false});
+    EXPECT_FALSE(target.isCursorHovering());
+
+    index.route(ds::ui::CursorAction::Move, {{505, 505}, false, false});
+    EXPECT_TRUE(target.isCursorHovering());
+    EXPECT_EQ(target.enterCount, 1);
+
+    target.setPositionWithOrigin(0.0f, 0.0f);
+    index.refresh();
+
+    index.route(ds::ui::CursorAction::Move, {{505, 505}, false, false});
+    EXPECT_FALSE(target.isCursorHovering());
+    EXPECT_EQ(target.leaveCount, 1);
+
+    index.remove(target);
+    EXPECT_EQ(index.size(), 0);
+
+    index.route(ds::ui::CursorAction::Move, {{5, 5}, false, false});
+    EXPECT_EQ(target.enterCount, 1);
+}
+
+TEST(CursorTargetIndex, FollowsTargetsThatMoveWithoutAnUpdate) {
+    auto target = IndexedTarget(0.0f, 0.0f, 10.0f, 10.0f);
+    auto index = ds::ui::CursorTargetIndex(16.0f);
+    index.insert(target);
+
+    target.setPositionWithOrigin(300.0f, 300.0f);
+    index.route(ds::ui::CursorAction::Move, {{305, 305}, false, false});
+    EXPECT_TRUE(target.isCursorHovering());
+
+    target.setSizeFromOrigin(40.0f, 40.0f);
+    target.translate(300.0f, -280.0f);
+    index.route(ds::ui::CursorAction::Move, {{305, 305}, false, false});
+    EXPECT_FALSE(target.isCursorHovering());
+    EXPECT_EQ(target.leaveCount, 1);
+
+    index.route(ds::ui::CursorAction::Move, {{630, 50}, false, false});
+    EXPECT_TRUE(target.isCursorHovering());
+    EXPECT_EQ(target.enterCount, 2);
+
+    index.remove(target);
+    EXPECT_EQ(target.getObserver(), nullptr);
+}
+
+TEST(CursorTargetIndex, ReindexesOnlyTheTargetsThatMoved) {
+    std::deque<IndexedTarget> targets;
+    auto index = ds::ui::CursorTargetIndex(16.0f);
+
+    for (auto i = 0; i < 100; ++i) {
+        index.insert(targets.emplace_back(static_cast<float>(i) * 20.0f, 0.0f, 10.0f, 10.0f));
+    }
+
+    targets[3].translate(0.0f, 100.0f);
+    targets[3].setSizeFromOrigin(20.0f, 20.0f);
+    targets[7].setPositionWithOrigin(0.0f, 300.0f);
+    EXPECT_EQ(index.pendingUpdateCount(), 2);
+
+    index.route(ds::ui::CursorAction::Move, {{65, 115}, false, false});
+    EXPECT_EQ(index.pendingUpdateCount(), 0);
+    EXPECT_TRUE(targets[3].isCursorHovering());
+    EXPECT_EQ(index.lastDeliveryCount(), 1);
+
+    targets[7].translate(5.0f, 0.0f);
+    index.remove(targets[7]);
+    EXPECT_EQ(index.pendingUpdateCount(), 0);
+}
+
+TEST(CursorTargetIndex, RejectsBoundsThatAreObservedElsewhere) {
+    auto target = IndexedTarget(0.0f, 0.0f, 10.0f, 10.0f);
+    auto other = IndexedTarget(0.0f, 0.0f, 10.0f, 10.0f);
+    auto index = ds::ui::CursorTargetIndex(16.0f);
+    index.insert(target);
+
+    {
+        auto secondIndex = ds::ui::CursorTargetIndex(16.0f);
+        EXPECT_THROW(secondIndex.insert(target), std::logic_error);
+        EXPECT_EQ(secondIndex.size(), 0);
+    }
+
+    EXPECT_THROW(index.insert(other, target), std::logic_error);
+    EXPECT_EQ(index.size(), 1);
+
+    target.translate(200.0f, 200.0f);
+    index.route(ds::ui::CursorAction::Move, {{205, 205}, false, false});
+    EXPECT_TRUE(target.isCursorHovering());
+}
+
+TEST(CursorTargetIndex, PressedTargetsReceiveRelease) {
+    auto target = IndexedTarget(0.0f, 0.0f, 10.0f, 10.0f);
+    auto index = ds::ui::CursorTargetIndex(16.0f);
+    index.insert(target);
+
+    index.route(ds::ui::CursorAction::Down, {{5, 5}, true, false});
+    EXPECT_TRUE(target.isBeingPressed());
+
+    index.route(ds::ui::CursorAction::Drag, {{400, 400}, true, false});
+    index.route(ds::ui::CursorAction::Drag, {{8, 8}, true, false});
+    index.route(ds::ui::CursorAction::Up, {{8, 8}, false, false});
+
+    EXPECT_FALSE(target.isBeingPressed());
+    EXPECT_EQ(target.releaseCount, 1);
+}
@@ -0,0 +1,216 @@
+//! @file TestDelegate.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <functional>
+#include <gtest/gtest.h>
+#include <Events/Delegate.hpp>
+#include <UI/Constructs/ButtonState.hpp>
+#include <UI/Constructs/SliderState.hpp>
+
+namespace {
+
+struct LifetimeCounter {
+    explicit LifetimeCounter(int& liveObjects): live(&liveObjects) {
+        ++*live;
+    }
+
+    LifetimeCounter(LifetimeCounter const& other) noexcept: live(other.live) {
+        ++*live;
+    }
+
+    LifetimeCounter(LifetimeCounter&& other) noexcept: live(other.live) {
+        ++*live;
+    }
+
+    ~LifetimeCounter() {
+        --*live;
+    }
+
+    int operator()(int const value) const {
+        return value * 2;
+    }
+
+    int* live;
+};
+
+template <ds::ui::ButtonStateType ButtonType, typename Callback>
+struct DelegateTestButton: public ds::ui::ButtonState<ButtonType, Callback> {
+    explicit DelegateTestButton(Callback&& callback):
+            ds::ui::ButtonState<ButtonType, Callback>(std::move(callback), false) {
+    }
+
+    [[nodiscard]] bool isCursorInBounds(ds::ui::CursorEvent const& event) const override {
+        return true;
+    }
+};
+
+template <typename Callback>
+struct DelegateTestSlider: public ds::ui::SliderState<float, Callback> {
+    explicit DelegateTestSlider(Callback&& callback):
+            ds::ui::SliderState<float, Callback>(0.0f, 0.0f, 100.0f, std::move(callback)) {
+    }
+
+    [[nodiscard]] bool isCursorInBounds(ds::ui::CursorEvent const& event) const override {
+        return true;
+    }
+
+    [[nodiscard]] float sliderOriginX() const override {
+        return 0.0f;
+    }
+
+    [[nodiscard]] float sliderWidthInPixels() const override {
+        return 100.0f;
+    }
+};
+
+ds::ui::CursorEvent delegateTestEvent(int const x) {
+    return {{x, 0}, true, false};
+}
+
+}
+
+TEST(FunctionRef, InvokesTheReferencedObject) {
+    auto total = 0;
+    auto accumulate = [&total](int const value) { total = total + value; };
+    auto const reference = ds::events::FunctionRef<void(int)>(accumulate);
+
+    reference(3);
+    reference(4);
+
+    ASSERT_TRUE(static_cast<bool>(reference));
+    ASSERT_EQ(total, 7);
+    ASSERT_FALSE(static_cast<bool>(ds::events::FunctionRef<void(int)>()));
+}
+
+TEST(InlineFunction, StoresCallableObjectsInline) {
+    auto const offset = 5;
+    auto function = ds::events::InlineFunction<int(int)>([offset](int const value) { return value + offset; });
+
+    ASSERT_TRUE(static_cast<bool>(function));
+    ASSERT_EQ(function(2), 7);
+
+    function = nullptr;
+    ASSERT_FALSE(static_cast<bool>(function));
+}
+
+TEST(InlineFunction, CopiesMovesAndDestroysItsCallable) {
+    auto live = 0;
+
+    {
+        auto function = ds::events::InlineFunction<int(int)>(LifetimeCounter(live));
+        ASSERT_EQ(live, 1);
+
+        auto copy = function;
+        ASSERT_EQ(live, 2);
+        ASSERT_EQ(copy(4), 8);
+
+        auto moved = std::move(function);
+        ASSERT_EQ(moved(5), 10);
+
+        copy = nullptr;
+        ASSERT_FALSE(static_cast<bool>(copy));
+    }
+
+    ASSERT_EQ(live, 0);
+}
+
+TEST(InlineFunction, StoresFunctionPointers) {
+    auto function = ds::events::InlineFunction<int(int)>(+[](int const value) { return -value; });
+
+    ASSERT_EQ(function(3), -3);
+    ASSERT_FALSE(ds::events::isCallable(static_cast<int (*)(int)>(nullptr)));
+}
+
+TEST(ButtonStateDelegate, LatchInvokesItsCallbackOnRelease) {
+    std::vector<bool> states;
+    auto button = DelegateTestButton<ds::ui::ButtonStateType::Latch, ds::events::InlineFunction<void(bool)>>(
+            [&states](bool const state) { states.push_back(state); });
+
+    button.cursorDown(delegateTestEvent(0));
+    ASSERT_TRUE(states.empty());
+
+    button.cursorUp(delegateTestEvent(0));
+    button.cursorDown(delegateTestEvent(0));
+    button.cursorUp(delegateTestEvent(0));
+
+    ASSERT_EQ(states, (std::vector<bool> {true, false}));
+}
+
+TEST(ButtonStateDelegate, MomentaryInvokesAnInlinedCallbackOnPressAndRelease) {
+    std::vector<bool> states;
+    auto callback = [&states](bool const state) { states.push_back(state); };
+    auto button = DelegateTestButton<ds::ui::ButtonStateType::Momentary, decltype(callback)>(std::move(callback));
+
+    button.cursorDown(delegateTestEvent(0));
+    ASSERT_TRUE(button.isButtonPressed());
+
+    button.cursorUp(delegateTestEvent(0));
+    ASSERT_FALSE(button.isButtonPressed());
+    ASSERT_EQ(states, (std::vector<bool> {true, false}));
+}
+
+TEST(SliderStateDelegate, InvokesAnInlinedCallbackOnEachDrag) {
+    auto latest = -1.0f;
+    auto calls = 0;
+    auto callback = [&](float const value) {
+        latest = value;
+        ++calls;
+    };
+
+    auto slider = DelegateTestSlider<decltype(callback)>(std::move(callback));
+    ASSERT_EQ(calls, 1);
+
+    slider.cursorDown(delegateTestEvent(0));
+    slider.cursorDrag(delegateTestEvent(25));
+    slider.cursorDrag(delegateTestEvent(40));
+
+    ASSERT_EQ(calls, 3);
+    ASSERT_FLOAT_EQ(latest, 40.0f);
+    ASSERT_FLOAT_EQ(slider.getValue(), 40.0f);
+}
+
+TEST(ButtonStateDelegate, AcceptsAStdFunction) {
+    std::vector<bool> states;
+    auto const callback = std::function<void(bool)>([&states](bool const state) { states.push_back(state); });
+    auto button = DelegateTestButton<ds::ui::ButtonStateType::Latch, ds::events::InlineFunction<void(bool)>>(callback);
+
+    button.cursorDown(delegateTestEvent(0));
+    button.cursorUp(delegateTestEvent(0));
+
+    ASSERT_EQ(states, (std::vector<bool> {true}));
+}
+
+TEST(SliderStateDelegate, AcceptsAStdFunctionAndLargeCaptures) {
+    auto latest = -1.0f;
+    auto scale = std::array<double, 2> {1.0, 2.0};
+    auto function = std::function<void(float)>([&latest](float const value) { latest = value; });
+
+    // The lambda captures a std::function and two doubles, which is more than the previous capacity of four pointers.
+
+    auto const callback = [function, scale](float const value) {
+        function(value * static_cast<float>(scale[1]));
+    };
+
+    static_assert(sizeof(callback) > 4 * sizeof(void*));
+
+    auto slider = DelegateTestSlider<ds::events::InlineFunction<void(float)>>(callback);
+    slider.cursorDown(delegateTestEvent(0));
+    slider.cursorDrag(delegateTestEvent(30));
+
+    ASSERT_FLOAT_EQ(latest, 60.0f);
+}
+
+TEST(SliderStateDelegate, AcceptsAnEmptyCallback) {
+    auto slider = DelegateTestSlider<ds::events::InlineFunction<void(float)>>(nullptr);
+
+    slider.cursorDown(delegateTestEvent(0));
+    slider.cursorDrag(delegateTestEvent(60));
+
+    ASSERT_FLOAT_EQ(slider.getValue(), 60.0f);
+}
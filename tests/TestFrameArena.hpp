@@ -0,0 +1,130 @@
+//! @file TestFrameArena.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <memory_resource>
+#include <gtest/gtest.h>
+#include <Memory/FrameArena.hpp>
+#include <Memory/CountingResource.hpp>
+#include <UI/Geometry/GridLines.hpp>
+
+namespace {
+
+//! @brief Build the kind of scratch data that a redraw builds: a few vertex buffers and an instance list.
+
+void buildFrameScratch(std::pmr::memory_resource* const resource) {
+    auto const outline = ds::ui::GridLineBuffer::getOutlineVertices();
+    for (auto i = 0; i < 4; ++i) {
+        std::pmr::vector<ds::ui::GridLineVertex> vertices(outline.begin(), outline.end(), resource);
+        vertices.insert(vertices.end(), outline.begin(), outline.end());
+    }
+
+    std::pmr::vector<float> instances(resource);
+    for (auto i = 0; i < 500; ++i) {
+        instances.push_back(static_cast<float>(i));
+    }
+}
+
+}
+
+TEST(CountingResource, CountsForwardedAllocations) {
+    auto counter = ds::memory::CountingResource();
+
+    {
+        std::pmr::vector<int> values(&counter);
+        values.reserve(16);
+        ASSERT_EQ(counter.getAllocationCount(), 1);
+        ASSERT_EQ(counter.getBytesInUse(), 16 * sizeof(int));
+    }
+
+    ASSERT_EQ(counter.getDeallocationCount(), 1);
+    ASSERT_EQ(counter.getBytesInUse(), 0);
+
+    counter.resetCounts();
+    ASSERT_EQ(counter.getAllocationCount(), 0);
+}
+
+TEST(FrameArena, ScratchDataNoLongerAllocatesFromTheHeap) {
+    auto heap = ds::memory::CountingResource();
+    buildFrameScratch(&heap);
+    auto const heapAllocations = heap.getAllocationCount();
+    ASSERT_GT(heapAllocations, 5);
+
+    auto upstream = ds::memory::CountingResource();
+    auto arena = ds::memory::FrameArena(64 * 1024, &upstream);
+    upstream.resetCounts();
+
+    for (auto frame = 0; frame < 3; ++frame) {
+        buildFrameScratch(&arena);
+        ASSERT_GE(arena.getAllocationCount(), heapAllocations);
+        ASSERT_FALSE(arena.hasOverflowed());
+        arena.reset();
+    }
+
+    ASSERT_EQ(upstream.getAllocationCount(), 0);
+    ASSERT_EQ(arena.getAllocationCount(), 0);
+    ASSERT_EQ(arena.getBytesAllocated(), 0);
+    ASSERT_GT(arena.getPeakBytes(), 0);
+}
+
+TEST(FrameArena, GrowsAfterAFrameOutgrowsItsBlock) {
+    auto upstream = ds::memory::CountingResource();
+    auto arena = ds::memory::FrameArena(256, &upstream);
+    ASSERT_EQ(arena.getCapacity(), 256);
+
+    buildFrameScratch(&arena);
+    ASSERT_TRUE(arena.hasOverflowed());
+    arena.reset();
+
+    ASSERT_GE(arena.getCapacity(), arena.getPeakBytes());
+    ASSERT_EQ(upstream.getBytesInUse(), arena.getCapacity());
+
+    upstream.resetCounts();
+    buildFrameScratch(&arena);
+    ASSERT_FALSE(arena.hasOverflowed());
+    ASSERT_EQ(upstream.getAllocationCount(), 0);
+}
+
+TEST(FrameArena, RespectsAlignment) {
+    auto arena = ds::memory::FrameArena(1024);
+
+    auto* const unaligned = arena.allocate(1, 1);
+    auto* const aligned = arena.allocate(16, 16);
+    auto* const wide = arena.allocate(8, 64);
+
+    ASSERT_NE(unaligned, nullptr);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 16, 0);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(wide) % 64, 0);
+    ASSERT_EQ(arena.getAllocationCount(), 3);
+}
+
+TEST(FrameArena, ReleasesItsMemoryWhenDestroyed) {
+    auto upstream = ds::memory::CountingResource();
+
+    {
+        auto arena = ds::memory::FrameArena(128, &upstream);
+        buildFrameScratch(&arena);
+    }
+
+    ASSERT_EQ(upstream.getBytesInUse(), 0);
+}
+
+TEST(FrameArena, EndFrameReleasesTheProcessWideArena) {
+    auto& arena = ds::memory::FrameArena::get();
+
+    for (auto frame = 0; frame < 3; ++frame) {
+        buildFrameScratch(&arena);
+        ASSERT_GT(arena.getBytesAllocated(), 0);
+
+        ds::memory::FrameArena::endFrame();
+        ASSERT_EQ(arena.getBytesAllocated(), 0);
+        ASSERT_EQ(arena.getAllocationCount(), 0);
+    }
+
+    ASSERT_FALSE(arena.hasOverflowed());
+    ASSERT_GE(arena.getCapacity(), arena.getPeakBytes());
+}
@@ -0,0 +1,89 @@
+//! @file TestGridCoverage.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <UI/Geometry/GridCoverage.hpp>
+
+namespace {
+
+//! @brief Compute the coverage at the given point of a grid of 4 columns and 3 rows of 20 pixel cells.
+
+float getTestCoverage(float const x, float const y, float const halfThickness = 1.0f) {
+    return ds::ui::getGridLineCoverage({x, y}, {20.0f, 20.0f}, {4, 3}, halfThickness);
+}
+
+}
+
+TEST(GridCoverage, CoversPixelsOnEachLine) {
+    for (auto column = 0; column <= 4; ++column) {
+        EXPECT_FLOAT_EQ(getTestCoverage(static_cast<float>(column) * 20.0f, 30.0f), 1.0f);
+    }
+
+    for (auto row = 0; row <= 3; ++row) {
+        EXPECT_FLOAT_EQ(getTestCoverage(50.0f, static_cast<float>(row) * 20.0f), 1.0f);
+    }
+}
+
+TEST(GridCoverage, LeavesCellInteriorsUncovered) {
+    EXPECT_FLOAT_EQ(getTestCoverage(10.0f, 10.0f), 0.0f);
+    EXPECT_FLOAT_EQ(getTestCoverage(70.0f, 50.0f), 0.0f);
+    EXPECT_FLOAT_EQ(getTestCoverage(5.0f, 15.0f), 0.0f);
+}
+
+TEST(GridCoverage, RampsOverOnePixelAtTheEdgeOfALine) {
+    EXPECT_FLOAT_EQ(getTestCoverage(21.0f, 10.0f), 0.5f);
+    EXPECT_FLOAT_EQ(getTestCoverage(21.25f, 10.0f), 0.25f);
+    EXPECT_FLOAT_EQ(getTestCoverage(20.5f, 10.0f), 1.0f);
+    EXPECT_FLOAT_EQ(getTestCoverage(21.5f, 10.0f), 0.0f);
+}
+
+TEST(GridCoverage, ScalesTheRampWithThePixelSize) {
+    auto const coverage = ds::ui::getGridLineCoverage({22.0f, 10.0f}, {20.0f, 20.0f}, {4, 3}, 1.0f, 4.0f);
+
+    EXPECT_FLOAT_EQ(coverage, 0.25f);
+}
+
+TEST(GridCoverage, StopsAtTheGridsEdges) {
+    // There is no line beyond the last column, and lines extend half their thickness past the edges.
+    EXPECT_FLOAT_EQ(getTestCoverage(100.0f, 30.0f), 0.0f);
+    EXPECT_FLOAT_EQ(getTestCoverage(80.0f, 61.0f), 0.5f);
+    EXPECT_FLOAT_EQ(getTestCoverage(80.0f, 63.0f), 0.0f);
+    EXPECT_FLOAT_EQ(getTestCoverage(-3.0f, 30.0f), 0.0f);
+    EXPECT_FLOAT_EQ(getTestCoverage(40.0f, -0.5f), 1.0f);
+}
+
+TEST(GridCoverage, ThickerLinesCoverMore) {
+    EXPECT_FLOAT_EQ(getTestCoverage(22.0f, 10.0f, 1.0f), 0.0f);
+    EXPECT_FLOAT_EQ(getTestCoverage(22.0f, 10.0f, 3.0f), 1.0f);
+}
+
+TEST(GridCoverage, ExtentCoversEveryLine) {
+    auto const extent = ds::ui::getGridLineExtent({20.0f, 10.0f}, {4, 3}, 2.0f);
+
+    EXPECT_FLOAT_EQ(extent.origin().x, -3.0f);
+    EXPECT_FLOAT_EQ(extent.origin().y, -3.0f);
+    EXPECT_FLOAT_EQ(extent.size().w, 86.0f);
+    EXPECT_FLOAT_EQ(extent.size().h, 36.0f);
+}
+
+TEST(GridCoverage, MatchesTheWidthOfTheLinesGeometry) {
+    // Sum the coverage of the pixels across a line and past the end of a line, which a `RuledGrid` with the same
+    // `LineThickness` covers by the thickness and by half of the thickness respectively.
+
+    for (auto const lineThickness: {1.0f, 2.0f, 3.0f, 4.0f}) {
+        auto const halfWidth = ds::ui::getLinesGeometryHalfWidth(lineThickness);
+        auto across = 0.0f;
+        auto past = 0.0f;
+
+        for (auto pixel = 0; pixel < 10; ++pixel) {
+            across = across + getTestCoverage(15.5f + static_cast<float>(pixel), 10.0f, halfWidth);
+            past = past + getTestCoverage(20.0f, -0.5f - static_cast<float>(pixel), halfWidth);
+        }
+
+        EXPECT_FLOAT_EQ(across, lineThickness);
+        EXPECT_FLOAT_EQ(past, lineThickness * 0.5f);
+    }
+}
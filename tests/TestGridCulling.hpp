@@ -0,0 +1,64 @@
+//! @file TestGridCulling.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <UI/Geometry/GridCulling.hpp>
+
+TEST(GridCulling, DrawsEveryCellOfAFullyVisibleGrid) {
+    auto const cells = ds::ui::getVisibleCells({10.0f, 10.0f}, {20.0f, 20.0f}, {8, 4}, {0.0f, 0.0f, 800.0f, 600.0f});
+
+    EXPECT_EQ(cells, (ds::ui::CellRange {0, 0, 8, 4}));
+    EXPECT_EQ(cells.count(), 32);
+}
+
+TEST(GridCulling, ClipsToTheViewport) {
+    // The viewport covers x in [100, 300] and y in [50, 90] of a grid whose cells are 20 by 10.
+    auto const cells = ds::ui::getVisibleCells({0.0f, 0.0f}, {20.0f, 10.0f}, {1000, 1000},
+                                               {100.0f, 50.0f, 200.0f, 40.0f});
+
+    EXPECT_EQ(cells.column, 5);
+    EXPECT_EQ(cells.columns, 11);
+    EXPECT_EQ(cells.row, 5);
+    EXPECT_EQ(cells.rows, 5);
+}
+
+TEST(GridCulling, AccountsForTheGridOriginAndMargin) {
+    auto const cells = ds::ui::getVisibleCells({-500.0f, 30.0f}, {10.0f, 10.0f}, {100, 100},
+                                               {0.0f, 0.0f, 95.0f, 95.0f}, 3.0f);
+
+    // Columns overlap [-3 + 500, 98 + 500] and rows overlap [-3 - 30, 98 - 30], in grid space.
+    EXPECT_EQ(cells.column, 49);
+    EXPECT_EQ(cells.columns, 11);
+    EXPECT_EQ(cells.row, 0);
+    EXPECT_EQ(cells.rows, 7);
+}
+
+TEST(GridCulling, ReturnsNoCellsWhenTheGridIsOffScreen) {
+    auto const right = ds::ui::getVisibleCells({900.0f, 0.0f}, {20.0f, 20.0f}, {10, 10}, {0.0f, 0.0f, 800.0f, 600.0f});
+    auto const above = ds::ui::getVisibleCells({0.0f, -300.0f}, {20.0f, 20.0f}, {10, 10}, {0.0f, 0.0f, 800.0f, 600.0f});
+    auto const empty = ds::ui::getVisibleCells({0.0f, 0.0f}, {20.0f, 20.0f}, {0, 10}, {0.0f, 0.0f, 800.0f, 600.0f});
+
+    EXPECT_TRUE(right.isEmpty());
+    EXPECT_TRUE(above.isEmpty());
+    EXPECT_TRUE(empty.isEmpty());
+    EXPECT_EQ(right.count(), 0);
+}
+
+TEST(GridCulling, HandlesDistantViewportsWithoutOverflow) {
+    auto const cells = ds::ui::getVisibleCells({0.0f, 0.0f}, {1.0f, 1.0f}, {10000, 10000},
+                                               {9990.0f, 1.0e12f, 1.0e12f, 10.0f});
+
+    EXPECT_TRUE(cells.isEmpty());
+}
+
+TEST(GridCulling, MapsInstancesToCellsInRowMajorOrder) {
+    auto const cells = ds::ui::CellRange {3, 7, 4, 2};
+
+    EXPECT_EQ(cells.getCell(0), (ds::ui::Point<int>(3, 7)));
+    EXPECT_EQ(cells.getCell(3), (ds::ui::Point<int>(6, 7)));
+    EXPECT_EQ(cells.getCell(4), (ds::ui::Point<int>(3, 8)));
+    EXPECT_EQ(cells.getCell(cells.count() - 1), (ds::ui::Point<int>(6, 8)));
+}
@@ -0,0 +1,99 @@
+//! @file TestGridLines.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <gtest/gtest.h>
+#include <UI/Geometry/GridLines.hpp>
+
+namespace {
+
+//! @brief Produce the line vertices that RuledGrid built with a VertBatch, in pixels.
+
+std::vector<ds::ui::Point<float>> getReferenceGridLines(int const rows, int const columns, float const w, float const h) {
+    std::vector<ds::ui::Point<float>> vertices;
+    for (int row = 0; row <= rows; ++row) {
+        vertices.emplace_back(0.0f, static_cast<float>(row) * h);
+        vertices.emplace_back(static_cast<float>(columns) * w, static_cast<float>(row) * h);
+    }
+
+    for (int col = 0; col <= columns; ++col) {
+        vertices.emplace_back(static_cast<float>(col) * w, 0.0f);
+        vertices.emplace_back(static_cast<float>(col) * w, static_cast<float>(rows) * h);
+    }
+
+    return vertices;
+}
+
+std::vector<ds::ui::Point<float>> getDrawnGridLines(ds::ui::GridLineBuffer const& buffer,
+                                                    int const rows, int const columns, float const w, float const h) {
+    std::vector<ds::ui::Point<float>> vertices;
+    for (auto const range: {buffer.getHorizontalRange(), buffer.getVerticalRange()}) {
+        for (auto i = range.first; i < range.first + range.count; ++i) {
+            vertices.push_back(ds::ui::GridLineBuffer::getPosition(buffer.getVertices()[i], {columns, rows}, {w, h}));
+        }
+    }
+
+    return vertices;
+}
+
+}
+
+TEST(GridLines, MatchesVertBatchLayout) {
+    auto buffer = ds::ui::GridLineBuffer(3, 5);
+    EXPECT_EQ(getDrawnGridLines(buffer, 3, 5, 20.0f, 10.0f), getReferenceGridLines(3, 5, 20.0f, 10.0f));
+
+    buffer.setDimensions(2, 7);
+    EXPECT_EQ(getDrawnGridLines(buffer, 2, 7, 15.0f, 15.0f), getReferenceGridLines(2, 7, 15.0f, 15.0f));
+}
+
+TEST(GridLines, ResizingWithinCapacityWritesOnlyNewLines) {
+    auto buffer = ds::ui::GridLineBuffer(8, 8);
+    buffer.clearDirtyRanges();
+
+    EXPECT_FALSE(buffer.setDimensions(4, 4));
+    EXPECT_TRUE(buffer.getDirtyRanges().empty());
+
+    EXPECT_FALSE(buffer.setDimensions(8, 8));
+    EXPECT_TRUE(buffer.getDirtyRanges().empty());
+
+    EXPECT_TRUE(buffer.setDimensions(10, 8));
+    buffer.clearDirtyRanges();
+
+    EXPECT_FALSE(buffer.setDimensions(14, 8));
+    ASSERT_EQ(buffer.getDirtyRanges().size(), 1);
+    EXPECT_EQ(buffer.getDirtyRanges()[0].first, 2 * 11);
+    EXPECT_EQ(buffer.getDirtyRanges()[0].count, 2 * 4);
+    EXPECT_EQ(getDrawnGridLines(buffer, 14, 8, 20.0f, 20.0f), getReferenceGridLines(14, 8, 20.0f, 20.0f));
+}
+
+TEST(GridLines, CapacityGrowsGeometrically) {
+    auto buffer = ds::ui::GridLineBuffer(1, 1);
+    auto reallocations = 0;
+
+    for (auto n = 2; n <= 256; ++n) {
+        reallocations += static_cast<int>(buffer.setDimensions(n, n));
+    }
+
+    EXPECT_LE(reallocations, 8);
+    EXPECT_EQ(getDrawnGridLines(buffer, 256, 256, 4.0f, 4.0f), getReferenceGridLines(256, 256, 4.0f, 4.0f));
+}
+
+TEST(GridLines, OutlineIsIndependentOfDimensions) {
+    auto const outline = ds::ui::GridLineBuffer::getOutlineVertices();
+    ASSERT_EQ(outline.size(), 8);
+
+    std::vector<ds::ui::Point<float>> vertices;
+    for (auto const& vertex: outline) {
+        vertices.push_back(ds::ui::GridLineBuffer::getPosition(vertex, {3, 2}, {20.0f, 10.0f}));
+    }
+
+    std::vector<ds::ui::Point<float>> const expected {
+            {0.0f, 0.0f}, {60.0f, 0.0f}, {0.0f, 20.0f}, {60.0f, 20.0f},
+            {0.0f, 0.0f}, {0.0f, 20.0f}, {60.0f, 0.0f}, {60.0f, 20.0f}
+    };
+
+    EXPECT_EQ(vertices, expected);
+}
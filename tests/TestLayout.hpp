@@ -0,0 +1,182 @@
+//! @file TestLayout.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <UI/Layout.hpp>
+
+namespace {
+
+struct LayoutComponent: public ds::ui::Component {
+    void draw(float const offsetX, float const offsetY) override {
+    }
+
+    void adjustToLayout() override {
+        ++adjustments;
+    }
+
+    int adjustments {0};
+};
+
+struct LayoutGrid: public ds::ui::Grid {
+    LayoutGrid(): ds::ui::Grid(1, 1, {10.0f, 25.0f}) {
+    }
+
+    void draw(float const offsetX, float const offsetY) override {
+    }
+};
+
+void expectLayoutBounds(ds::ui::Bounds<float> const& bounds, float x, float y, float width, float height) {
+    EXPECT_FLOAT_EQ(bounds.origin().x, x);
+    EXPECT_FLOAT_EQ(bounds.origin().y, y);
+    EXPECT_FLOAT_EQ(bounds.size().w, width);
+    EXPECT_FLOAT_EQ(bounds.size().h, height);
+}
+
+}
+
+TEST(Layout, CarvesFixedFractionalAndFlexibleLengths) {
+    using ds::ui::LayoutSize;
+
+    auto layout = ds::ui::Layout();
+    auto const header = layout.add(ds::ui::Layout::root, LayoutSize::fixed(40.0f));
+    auto const body = layout.add(ds::ui::Layout::root, LayoutSize::flex(), ds::ui::LayoutDirection::Row);
+    auto const footer = layout.add(ds::ui::Layout::root, LayoutSize::fraction(0.1f));
+
+    auto const sidebar = layout.add(body, LayoutSize::fraction(0.25f));
+    auto const content = layout.add(body, LayoutSize::flex(3.0f));
+    auto const inspector = layout.add(body, LayoutSize::flex(1.0f));
+
+    layout.solve({0.0f, 0.0f, 800.0f, 600.0f});
+
+    expectLayoutBounds(layout.getBounds(header), 0.0f, 0.0f, 800.0f, 40.0f);
+    expectLayoutBounds(layout.getBounds(body), 0.0f, 40.0f, 800.0f, 500.0f);
+    expectLayoutBounds(layout.getBounds(footer), 0.0f, 540.0f, 800.0f, 60.0f);
+    expectLayoutBounds(layout.getBounds(sidebar), 0.0f, 40.0f, 200.0f, 500.0f);
+    expectLayoutBounds(layout.getBounds(content), 200.0f, 40.0f, 450.0f, 500.0f);
+    expectLayoutBounds(layout.getBounds(inspector), 650.0f, 40.0f, 150.0f, 500.0f);
+}
+
+TEST(Layout, CarvesFromEitherEdgeWithGaps) {
+    using ds::ui::LayoutSize;
+
+    auto layout = ds::ui::Layout({20.0f, 20.0f}, ds::ui::LayoutDirection::Row);
+    layout.setGap(ds::ui::Layout::root, 10.0f);
+
+    auto const left = layout.add(ds::ui::Layout::root, LayoutSize::fixed(100.0f));
+    auto const right = layout.add(ds::ui::Layout::root, LayoutSize::cells(3));
+    auto const middle = layout.add(ds::ui::Layout::root, LayoutSize::flex());
+    layout.setAlignment(right, ds::ui::LayoutAlignment::End);
+
+    layout.solve({10.0f, 10.0f, 400.0f, 50.0f});
+
+    expectLayoutBounds(layout.getBounds(left), 10.0f, 10.0f, 100.0f, 50.0f);
+    expectLayoutBounds(layout.getBounds(right), 350.0f, 10.0f, 60.0f, 50.0f);
+    expectLayoutBounds(layout.getBounds(middle), 120.0f, 10.0f, 220.0f, 50.0f);
+}
+
+TEST(Layout, ClampsNodesThatDoNotFit) {
+    using ds::ui::LayoutSize;
+
+    auto layout = ds::ui::Layout();
+    auto const first = layout.add(ds::ui::Layout::root, LayoutSize::fixed(80.0f));
+    auto const second = layout.add(ds::ui::Layout::root, LayoutSize::fixed(80.0f));
+    auto const third = layout.add(ds::ui::Layout::root, LayoutSize::flex());
+
+    layout.solve({0.0f, 0.0f, 100.0f, 100.0f});
+
+    expectLayoutBounds(layout.getBounds(first), 0.0f, 0.0f, 100.0f, 80.0f);
+    expectLayoutBounds(layout.getBounds(second), 0.0f, 80.0f, 100.0f, 20.0f);
+    expectLayoutBounds(layout.getBounds(third), 0.0f, 100.0f, 100.0f, 0.0f);
+}
+
+TEST(Layout, SnapsBoundGridsToWholeCells) {
+    using ds::ui::LayoutSize;
+
+    auto layout = ds::ui::Layout();
+    auto grid = LayoutGrid();
+    auto const toolbar = layout.add(ds::ui::Layout::root, LayoutSize::cells(2));
+    auto const canvas = layout.add(ds::ui::Layout::root, LayoutSize::flex());
+    layout.bind(toolbar, grid);
+
+    layout.solve({0.0f, 0.0f, 95.0f, 300.0f});
+
+    expectLayoutBounds(layout.getBounds(toolbar), 0.0f, 0.0f, 95.0f, 50.0f);
+    expectLayoutBounds(layout.getBounds(canvas), 0.0f, 50.0f, 95.0f, 250.0f);
+    EXPECT_EQ(grid.dimensions().w, 9);
+    EXPECT_EQ(grid.dimensions().h, 2);
+    EXPECT_FLOAT_EQ(grid.size().w, 90.0f);
+    EXPECT_TRUE(grid.getShouldRedraw());
+}
+
+TEST(Layout, UpdatesBoundComponentsOnlyWhenTheirBoundsChange) {
+    using ds::ui::LayoutSize;
+
+    auto layout = ds::ui::Layout();
+    auto header = LayoutComponent();
+    auto body = LayoutComponent();
+    layout.bind(layout.add(ds::ui::Layout::root, LayoutSize::fixed(30.0f)), header);
+    layout.bind(layout.add(ds::ui::Layout::root, LayoutSize::flex()), body);
+
+    layout.solve({0.0f, 0.0f, 200.0f, 100.0f});
+    expectLayoutBounds(body, 0.0f, 30.0f, 200.0f, 70.0f);
+    EXPECT_EQ(header.adjustments, 1);
+    EXPECT_EQ(body.adjustments, 1);
+
+    layout.solve({0.0f, 0.0f, 200.0f, 150.0f});
+    expectLayoutBounds(body, 0.0f, 30.0f, 200.0f, 120.0f);
+    EXPECT_EQ(header.adjustments, 1);
+    EXPECT_EQ(body.adjustments, 2);
+}
+
+TEST(Layout, ReusesCachedSubtrees) {
+    using ds::ui::LayoutSize;
+
+    auto layout = ds::ui::Layout();
+    auto const header = layout.add(ds::ui::Layout::root, LayoutSize::fixed(40.0f), ds::ui::LayoutDirection::Row);
+    auto const body = layout.add(ds::ui::Layout::root, LayoutSize::flex(), ds::ui::LayoutDirection::Row);
+
+    for (auto i = 0; i < 10; ++i) {
+        layout.add(header, LayoutSize::flex());
+        layout.add(body, LayoutSize::flex());
+    }
+
+    EXPECT_EQ(layout.solve({0.0f, 0.0f, 800.0f, 600.0f}), 23);
+    EXPECT_EQ(layout.solve({0.0f, 0.0f, 800.0f, 600.0f}), 0);
+
+    // A taller window leaves the header untouched, so only the root, the body and the body's children are solved.
+
+    EXPECT_EQ(layout.solve({0.0f, 0.0f, 800.0f, 700.0f}), 12);
+    EXPECT_EQ(layout.getStatistics().changed, 12);
+
+    // Changing one header cell's constraint solves the header and the cells whose areas moved.
+
+    auto const firstCell = layout.add(header, LayoutSize::fixed(80.0f));
+    EXPECT_EQ(layout.solve({0.0f, 0.0f, 800.0f, 700.0f}), 12);
+    EXPECT_EQ(layout.getStatistics().visited, 13);
+
+    layout.setSize(firstCell, LayoutSize::fixed(80.0f));
+    EXPECT_EQ(layout.solve({0.0f, 0.0f, 800.0f, 700.0f}), 0);
+}
+
+TEST(Layout, RemovingANodeReleasesItsSpace) {
+    using ds::ui::LayoutSize;
+
+    auto layout = ds::ui::Layout();
+    auto const first = layout.add(ds::ui::Layout::root, LayoutSize::fixed(30.0f));
+    auto const nested = layout.add(first, LayoutSize::flex());
+    auto const second = layout.add(ds::ui::Layout::root, LayoutSize::flex());
+    layout.solve({0.0f, 0.0f, 100.0f, 100.0f});
+    ASSERT_EQ(layout.size(), 3);
+
+    layout.remove(first);
+    layout.solve({0.0f, 0.0f, 100.0f, 100.0f});
+
+    ASSERT_EQ(layout.size(), 1);
+    expectLayoutBounds(layout.getBounds(second), 0.0f, 0.0f, 100.0f, 100.0f);
+
+    auto const reused = layout.add(ds::ui::Layout::root, LayoutSize::fixed(10.0f));
+    EXPECT_TRUE(reused == first or reused == nested);
+}
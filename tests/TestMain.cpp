@@ -4,6 +4,29 @@
 #include <gtest/gtest.h>
 #include "TestPoint.hpp"
 #include "TestBounds.hpp"
+#include "TestBoundsBatch.hpp"
+#include "TestBoundsValue.hpp"
+#include "TestConcurrentDispatcher.hpp"
+#include "TestChannel.hpp"
+#include "TestCursorEventQueue.hpp"
+#include "TestCursorTargetIndex.hpp"
+#include "TestSceneGraph.hpp"
+#include "TestButtonInstances.hpp"
+#include "TestGridLines.hpp"
+#include "TestProgramCache.hpp"
+#include "TestTextLayout.hpp"
+#include "TestNumberFormat.hpp"
+#include "TestRecordingRenderer.hpp"
+#include "TestProfiler.hpp"
+#include "TestCellStorage.hpp"
+#include "TestGridCulling.hpp"
+#include "TestGridCoverage.hpp"
+#include "TestCellSelection.hpp"
+#include "TestParameterBridge.hpp"
+#include "TestDelegate.hpp"
+#include "TestFrameArena.hpp"
+#include "TestWorkStealingPool.hpp"
+#include "TestLayout.hpp"
 
 int main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,74 @@
+//! @file TestNumberFormat.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <limits>
+#include <string>
+#include <iomanip>
+#include <sstream>
+#include <gtest/gtest.h>
+#include <UI/Constructs/NumberFormat.hpp>
+
+namespace {
+
+template <typename T>
+std::string formatWithStream(T const value, int const precision) {
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(precision) << value;
+    return stream.str();
+}
+
+}
+
+TEST(NumberFormat, MatchesFixedStreamFormatting) {
+    auto format = ds::ui::NumberFormat<float>(2);
+
+    for (auto i = -2000; i <= 2000; ++i) {
+        auto const value = static_cast<float>(i) * 0.0137f;
+        format.format(value);
+        EXPECT_EQ(format.view(), formatWithStream(value, 2));
+    }
+
+    auto precise = ds::ui::NumberFormat<double>(5);
+    for (auto const value: {0.0, -0.0, 1.0 / 3.0, 2.5e-7, 123456.789, -1.0e12}) {
+        precise.format(value);
+        EXPECT_EQ(precise.view(), formatWithStream(value, 5));
+    }
+}
+
+TEST(NumberFormat, FormatsIntegersInFullWithUnits) {
+    auto format = ds::ui::NumberFormat<int>(2, " BPM");
+
+    format.format(120);
+    EXPECT_EQ(format.view(), "120 BPM");
+
+    format.format(std::numeric_limits<int>::min());
+    EXPECT_EQ(format.view(), std::to_string(std::numeric_limits<int>::min()) + " BPM");
+
+    format.setUnits("");
+    format.format(-7);
+    EXPECT_EQ(format.view(), "-7");
+}
+
+TEST(NumberFormat, ReportsWhetherTheTextChanged) {
+    auto format = ds::ui::NumberFormat<float>(1, "dB");
+
+    EXPECT_TRUE(format.format(-6.0f));
+    EXPECT_FALSE(format.format(-6.0f));
+    EXPECT_FALSE(format.format(-6.01f));
+    EXPECT_TRUE(format.format(-6.1f));
+    EXPECT_EQ(format.view(), "-6.1dB");
+
+    format.setPrecision(0);
+    EXPECT_TRUE(format.format(-6.1f));
+    EXPECT_EQ(format.view(), "-6dB");
+}
+
+TEST(NumberFormat, FallsBackToScientificNotationForHugeValues) {
+    auto format = ds::ui::NumberFormat<double>(2);
+
+    format.format(std::numeric_limits<double>::max());
+    EXPECT_EQ(format.view(), "1.80e+308");
+}
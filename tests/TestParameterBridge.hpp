@@ -0,0 +1,344 @@
+//! @file TestParameterBridge.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Concurrency/SpscRing.hpp>
+#include <Concurrency/ParameterBridge.hpp>
+#include <UI/Constructs/SliderState.hpp>
+#include <UI/Constructs/ScrollableValue.hpp>
+
+namespace {
+
+struct BridgeTestSlider: public ds::ui::SliderState<float> {
+    BridgeTestSlider():
+            ds::ui::SliderState<float>(0.0f, 0.0f, 10.0f, nullptr) {
+    }
+
+    [[nodiscard]] bool isCursorInBounds(ds::ui::CursorEvent const& event) const override {
+        return true;
+    }
+
+    [[nodiscard]] float sliderOriginX() const override {
+        return 0.0f;
+    }
+
+    [[nodiscard]] float sliderWidthInPixels() const override {
+        return 100.0f;
+    }
+};
+
+struct BridgeTestScrollable: public ds::ui::ScrollableValue<int> {
+    BridgeTestScrollable():
+            ds::ui::ScrollableValue<int>(0, 5, 100) {
+    }
+
+    [[nodiscard]] bool isCursorInBounds(ds::ui::CursorEvent const& event) const override {
+        return true;
+    }
+};
+
+}
+
+TEST(SpscRing, DropsValuesWhenFull) {
+    auto ring = ds::concurrency::SpscRing<int, 4>();
+
+    for (auto i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.push(i));
+    }
+
+    EXPECT_FALSE(ring.push(4));
+    EXPECT_EQ(ring.size(), 4);
+
+    auto value = 0;
+    for (auto i = 0; i < 4; ++i) {
+        ASSERT_TRUE(ring.pop(value));
+        EXPECT_EQ(value, i);
+    }
+
+    EXPECT_FALSE(ring.pop(value));
+}
+
+TEST(SpscRing, DeliversEveryValueInOrderAcrossThreads) {
+    auto ring = ds::concurrency::SpscRing<int, 1024>();
+    auto constexpr count = 100000;
+
+    auto producer = std::thread([&ring]() {
+        for (auto i = 0; i < count; ++i) {
+            while (not ring.push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    auto expected = 0;
+    auto value = 0;
+    while (expected < count) {
+        if (ring.pop(value)) {
+            ASSERT_EQ(value, expected);
+            expected = expected + 1;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+}
+
+TEST(ParameterBridge, DeliversUpdatesInOrder) {
+    auto bridge = ds::concurrency::ParameterBridge();
+
+    EXPECT_TRUE(bridge.publish(3, 0.5f));
+    EXPECT_TRUE(bridge.publish(1, 0.25f));
+    EXPECT_TRUE(bridge.publish(3, 0.75f));
+
+    std::array<ds::concurrency::ParameterUpdate, 8> block {};
+    ASSERT_EQ(bridge.receive(block.data(), block.size()), 3);
+
+    EXPECT_EQ(block[0].parameter, 3);
+    EXPECT_FLOAT_EQ(block[0].value, 0.5f);
+    EXPECT_EQ(block[1].parameter, 1);
+    EXPECT_EQ(block[2].parameter, 3);
+    EXPECT_FLOAT_EQ(block[2].value, 0.75f);
+    EXPECT_LE(block[0].timestamp, block[1].timestamp);
+    EXPECT_LE(block[1].timestamp, block[2].timestamp);
+    EXPECT_EQ(bridge.receive(block.data(), block.size()), 0);
+}
+
+TEST(ParameterBridge, KeepsUpdatesThatDoNotFitInABacklog) {
+    auto bridge = ds::concurrency::ParameterBridge();
+    auto const capacity = ds::concurrency::ParameterBridge::Capacity;
+
+    for (std::size_t i = 0; i < capacity + 10; ++i) {
+        bridge.publish(static_cast<std::uint32_t>(i < capacity ? 0 : i), static_cast<float>(i));
+    }
+
+    EXPECT_EQ(bridge.getBacklogSize(), 10);
+
+    auto expected = 0.0f;
+    auto const check = [&expected](ds::concurrency::ParameterUpdate const& update) {
+        EXPECT_FLOAT_EQ(update.value, expected);
+        expected = expected + 1.0f;
+    };
+
+    EXPECT_EQ(bridge.drain(check, 100), 100);
+    EXPECT_TRUE(bridge.flush());
+    EXPECT_EQ(bridge.getBacklogSize(), 0);
+
+    bridge.drain(check);
+    EXPECT_FLOAT_EQ(expected, static_cast<float>(capacity + 10));
+}
+
+TEST(ParameterBridge, LosesNoUpdatesUnderConcurrentStress) {
+    auto bridge = ds::concurrency::ParameterBridge();
+    auto constexpr parameters = 8u;
+    auto constexpr updatesPerParameter = 50000u;
+    auto isPublishing = std::atomic<bool> {true};
+
+    auto producer = std::thread([&bridge, &isPublishing]() {
+        for (auto i = 0u; i < updatesPerParameter; ++i) {
+            for (auto parameter = 0u; parameter < parameters; ++parameter) {
+                // A full ring coalesces later updates, so wait for the backlog to drain to check that none is lost.
+                if (not bridge.publish(parameter, static_cast<float>(i))) {
+                    while (not bridge.flush()) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        }
+
+        while (not bridge.flush()) {
+            std::this_thread::yield();
+        }
+
+        isPublishing.store(false, std::memory_order_release);
+    });
+
+    std::array<ds::concurrency::ParameterUpdate, 256> block {};
+    std::array<float, parameters> lastValue {};
+    lastValue.fill(-1.0f);
+
+    auto received = std::size_t {0};
+    auto lastTimestamp = std::int64_t {0};
+    auto isOrdered = true;
+
+    while (true) {
+        auto const isDone = not isPublishing.load(std::memory_order_acquire);
+        auto const count = bridge.receive(block.data(), block.size());
+
+        for (std::size_t i = 0; i < count; ++i) {
+            auto const& update = block[i];
+            auto const expected = static_cast<float>(received / parameters);
+
+            isOrdered = isOrdered and update.parameter == received % parameters;
+            isOrdered = isOrdered and update.value == expected and update.value == lastValue[update.parameter] + 1.0f;
+            isOrdered = isOrdered and update.timestamp >= lastTimestamp;
+
+            lastValue[update.parameter] = update.value;
+            lastTimestamp = update.timestamp;
+            received = received + 1;
+        }
+
+        if (isDone and count == 0) {
+            break;
+        }
+
+        if (count == 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+
+    EXPECT_TRUE(isOrdered);
+    EXPECT_EQ(received, std::size_t {parameters} * updatesPerParameter);
+}
+
+TEST(ParameterBridge, CoalescesTheBacklogToTheLastValueOfEachParameter) {
+    auto bridge = ds::concurrency::ParameterBridge();
+    auto const capacity = ds::concurrency::ParameterBridge::Capacity;
+
+    for (std::size_t i = 0; i < capacity; ++i) {
+        EXPECT_TRUE(bridge.publish(0, 0.0f));
+    }
+
+    for (auto i = 1; i <= 100; ++i) {
+        EXPECT_FALSE(bridge.publish(1, static_cast<float>(i)));
+        EXPECT_FALSE(bridge.publish(2, static_cast<float>(-i)));
+    }
+
+    EXPECT_FALSE(bridge.publish(1, 7.0f));
+    EXPECT_EQ(bridge.getBacklogSize(), 2);
+    EXPECT_FALSE(bridge.flush());
+
+    EXPECT_EQ(bridge.drain([](ds::concurrency::ParameterUpdate const& update) {}, capacity), capacity);
+    EXPECT_TRUE(bridge.flush());
+
+    std::vector<ds::concurrency::ParameterUpdate> updates;
+    bridge.drain([&updates](ds::concurrency::ParameterUpdate const& update) {
+        updates.push_back(update);
+    });
+
+    ASSERT_EQ(updates.size(), 2);
+    EXPECT_EQ(updates[0].parameter, 2);
+    EXPECT_FLOAT_EQ(updates[0].value, -100.0f);
+    EXPECT_EQ(updates[1].parameter, 1);
+    EXPECT_FLOAT_EQ(updates[1].value, 7.0f);
+    EXPECT_LE(updates[0].timestamp, updates[1].timestamp);
+}
+
+TEST(ParameterBridge, BoundsTheBacklog) {
+    auto bridge = ds::concurrency::ParameterBridge();
+    auto const capacity = ds::concurrency::ParameterBridge::Capacity;
+    auto const backlogCapacity = ds::concurrency::ParameterBridge::BacklogCapacity;
+
+    for (std::size_t i = 0; i < capacity + backlogCapacity + 5; ++i) {
+        bridge.publish(static_cast<std::uint32_t>(i), 1.0f);
+    }
+
+    EXPECT_EQ(bridge.getBacklogSize(), backlogCapacity);
+    EXPECT_EQ(bridge.getDroppedCount(), 5);
+}
+
+TEST(ParameterBridge, ControlsDeliverTheirBacklogAfterThePublisherStops) {
+    auto bridge = ds::concurrency::ParameterBridge();
+    auto bank = ds::concurrency::ParameterBank(4);
+    auto slider = BridgeTestSlider();
+    auto scrollable = BridgeTestScrollable();
+    slider.setParameterBinding({&bridge, 2});
+    scrollable.setParameterBinding({&bridge, 3});
+
+    for (std::size_t i = 0; i < ds::concurrency::ParameterBridge::Capacity; ++i) {
+        bridge.publish(0, static_cast<float>(i));
+    }
+
+    // A fast drag overflows the ring, then the cursor rests and nothing else is published.
+
+    for (auto i = 1; i <= 20; ++i) {
+        slider.setValue(static_cast<float>(i) * 0.5f);
+        scrollable.setValue(i);
+    }
+
+    EXPECT_EQ(bridge.getBacklogSize(), 2);
+
+    bank.update(bridge);
+    EXPECT_FLOAT_EQ(bank.getValue(2), 0.0f);
+
+    // Drawing the controls retries the backlog, so the worker reaches the values at which they rest.
+
+    slider.flushParameterBinding();
+    scrollable.flushParameterBinding();
+    EXPECT_EQ(bridge.getBacklogSize(), 0);
+
+    bank.update(bridge);
+    EXPECT_FLOAT_EQ(bank.getValue(2), 10.0f);
+    EXPECT_FLOAT_EQ(bank.getValue(3), 20.0f);
+}
+
+TEST(LinearSmoother, RampsToTheTargetInTheGivenNumberOfSteps) {
+    auto smoother = ds::concurrency::LinearSmoother(0.0f);
+
+    smoother.setTarget(1.0f, 4);
+    EXPECT_TRUE(smoother.isSmoothing());
+    EXPECT_FLOAT_EQ(smoother.next(), 0.25f);
+    EXPECT_FLOAT_EQ(smoother.next(), 0.5f);
+    EXPECT_FLOAT_EQ(smoother.skip(1), 0.75f);
+    EXPECT_FLOAT_EQ(smoother.next(), 1.0f);
+    EXPECT_FALSE(smoother.isSmoothing());
+    EXPECT_FLOAT_EQ(smoother.next(), 1.0f);
+
+    smoother.setTarget(-1.0f, 0);
+    EXPECT_FLOAT_EQ(smoother.getValue(), -1.0f);
+}
+
+TEST(ParameterBank, AppliesUpdatesWithOptionalSmoothing) {
+    auto bridge = ds::concurrency::ParameterBridge();
+    auto bank = ds::concurrency::ParameterBank(2);
+    bank.setSmoothing(1, 10);
+
+    bridge.publish(0, 4.0f);
+    bridge.publish(1, 2.0f);
+    bridge.publish(7, 9.0f);
+
+    EXPECT_EQ(bank.update(bridge), 3);
+    EXPECT_FLOAT_EQ(bank.getValue(0), 4.0f);
+    EXPECT_FLOAT_EQ(bank.getValue(1), 0.0f);
+
+    bank.advance(5);
+    EXPECT_FLOAT_EQ(bank.getValue(1), 1.0f);
+
+    bank.advance(100);
+    EXPECT_FLOAT_EQ(bank.getValue(1), 2.0f);
+    EXPECT_FALSE(bank.getSmoother(1).isSmoothing());
+}
+
+TEST(ParameterBridge, PublishesChangesFromSliderAndScrollableStates) {
+    auto bridge = ds::concurrency::ParameterBridge();
+    auto slider = BridgeTestSlider();
+    auto scrollable = BridgeTestScrollable();
+
+    slider.setParameterBinding({&bridge, 2});
+    scrollable.setParameterBinding({&bridge, 5});
+
+    slider.setValue(2.5f);
+    scrollable.setValue(42);
+    slider.setParameterBinding({});
+    slider.setValue(7.0f);
+
+    std::vector<ds::concurrency::ParameterUpdate> updates;
+    bridge.drain([&updates](ds::concurrency::ParameterUpdate const& update) {
+        updates.push_back(update);
+    });
+
+    ASSERT_EQ(updates.size(), 2);
+    EXPECT_EQ(updates[0].parameter, 2);
+    EXPECT_FLOAT_EQ(updates[0].value, 2.5f);
+    EXPECT_EQ(updates[1].parameter, 5);
+    EXPECT_FLOAT_EQ(updates[1].value, 42.0f);
+}
@@ -0,0 +1,104 @@
+//! @file TestProfiler.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <sstream>
+#include <gtest/gtest.h>
+#include <Profiling/Profiler.hpp>
+
+TEST(Profiler, RecordsSamplesAndCreationsPerFrame) {
+    auto profiler = ds::profiling::Profiler();
+    using ds::profiling::Phase;
+    using ds::profiling::Resource;
+
+    profiler.beginFrame();
+    {
+        auto const sample = ds::profiling::ScopedSample("Button", Phase::Draw, profiler);
+    }
+    profiler.countCreation(Resource::Batch);
+    profiler.countCreation(Resource::Batch);
+    profiler.countCreation(Resource::Texture);
+    profiler.endFrame();
+
+    profiler.beginFrame();
+    profiler.record("Label", Phase::Rebuild, profiler.now(), 500);
+    profiler.endFrame();
+
+    profiler.collect();
+
+    auto const& samples = profiler.getSamples();
+    ASSERT_EQ(samples.size(), 2);
+    EXPECT_STREQ(samples[0].name, "Button");
+    EXPECT_EQ(samples[0].frame, 0);
+    EXPECT_GE(samples[0].duration, 0);
+    EXPECT_STREQ(samples[1].name, "Label");
+    EXPECT_EQ(samples[1].frame, 1);
+
+    auto const& frames = profiler.getFrames();
+    ASSERT_EQ(frames.size(), 2);
+    EXPECT_EQ(frames[0].creations[static_cast<std::size_t>(Resource::Batch)], 2);
+    EXPECT_EQ(frames[0].creations[static_cast<std::size_t>(Resource::Texture)], 1);
+    EXPECT_EQ(frames[0].creations[static_cast<std::size_t>(Resource::Program)], 0);
+    EXPECT_EQ(frames[1].creations[static_cast<std::size_t>(Resource::Batch)], 0);
+}
+
+TEST(Profiler, SummarisesByComponentTypeAndPhase) {
+    auto profiler = ds::profiling::Profiler();
+    using ds::profiling::Phase;
+
+    profiler.record("Button", Phase::Draw, 0, 100);
+    profiler.record("Button", Phase::Draw, 200, 300);
+    profiler.record("Button", Phase::Rebuild, 600, 50);
+    profiler.record("Label", Phase::Draw, 700, 1000);
+    profiler.collect();
+
+    auto const summaries = profiler.summarise();
+    ASSERT_EQ(summaries.size(), 3);
+
+    EXPECT_STREQ(summaries[0].name, "Label");
+    EXPECT_EQ(summaries[0].total, 1000);
+
+    EXPECT_STREQ(summaries[1].name, "Button");
+    EXPECT_EQ(summaries[1].phase, Phase::Draw);
+    EXPECT_EQ(summaries[1].count, 2);
+    EXPECT_EQ(summaries[1].total, 400);
+    EXPECT_EQ(summaries[1].maximum, 300);
+
+    EXPECT_EQ(summaries[2].phase, Phase::Rebuild);
+}
+
+TEST(Profiler, CountsDroppedSamples) {
+    auto profiler = ds::profiling::Profiler();
+
+    for (std::size_t i = 0; i < ds::profiling::Profiler::SampleCapacity + 10; ++i) {
+        profiler.record("Button", ds::profiling::Phase::Draw, 0, 1);
+    }
+
+    EXPECT_EQ(profiler.getDroppedSamples(), 10);
+
+    profiler.clear();
+    EXPECT_TRUE(profiler.getSamples().empty());
+    EXPECT_EQ(profiler.getDroppedSamples(), 0);
+}
+
+TEST(Profiler, WritesChromeTrace) {
+    auto profiler = ds::profiling::Profiler();
+
+    profiler.beginFrame();
+    profiler.record("Grid \"A\"", ds::profiling::Phase::Event, 1500, 2250);
+    profiler.countCreation(ds::profiling::Resource::Program);
+    profiler.endFrame();
+    profiler.collect();
+
+    auto stream = std::ostringstream();
+    profiler.writeChromeTrace(stream);
+    auto const trace = stream.str();
+
+    EXPECT_EQ(trace.rfind(R"({"displayTimeUnit":"ns","traceEvents":[)", 0), 0);
+    EXPECT_NE(trace.find(R"("name":"Grid \"A\"","cat":"event","ph":"X")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("ts":1.500,"dur":2.250)"), std::string::npos);
+    EXPECT_NE(trace.find(R"("batches":0,"textures":0,"programs":1)"), std::string::npos);
+    EXPECT_EQ(trace.substr(trace.size() - 2), "]}");
+}
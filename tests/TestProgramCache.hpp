@@ -0,0 +1,67 @@
+//! @file TestProgramCache.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <gtest/gtest.h>
+#include <Shaders/Lines.hpp>
+#include <Shaders/GridCells.hpp>
+#include <Shaders/ProgramCache.hpp>
+
+namespace {
+
+using TestProgram = std::shared_ptr<std::string>;
+
+struct CountingProgramFactory {
+    TestProgram operator()(ds::ui::shader::ProgramSource const& source) {
+        ++compileCount;
+        return std::make_shared<std::string>(source.vertex);
+    }
+
+    int compileCount {0};
+};
+
+}
+
+TEST(ProgramCache, IdenticalSourcesShareOneProgram) {
+    using namespace ds::ui::shader;
+    auto cache = ProgramCache<TestProgram> {};
+    auto factory = CountingProgramFactory {};
+
+    auto const first = cache.get({150, GridLinesVertex(), LinesFragment(), LinesGeometry()}, factory);
+    for (auto i = 0; i < 99; ++i) {
+        EXPECT_EQ(cache.get({150, GridLinesVertex(), LinesFragment(), LinesGeometry()}, factory), first);
+    }
+
+    EXPECT_EQ(factory.compileCount, 1);
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.statistics().hits, 99);
+    EXPECT_EQ(cache.statistics().misses, 1);
+}
+
+TEST(ProgramCache, SourcesAndFormatDistinguishPrograms) {
+    using namespace ds::ui::shader;
+    auto cache = ProgramCache<TestProgram> {};
+    auto factory = CountingProgramFactory {};
+
+    auto const lines = cache.get({150, GridLinesVertex(), LinesFragment(), LinesGeometry()}, factory);
+    auto const cells = cache.get({150, GridCellsVertex(), GridCellsFragment()}, factory);
+    auto const legacy = cache.get({120, GridCellsVertex(), GridCellsFragment()}, factory);
+
+    EXPECT_NE(lines, cells);
+    EXPECT_NE(cells, legacy);
+    EXPECT_EQ(factory.compileCount, 3);
+    EXPECT_EQ(cache.statistics().misses, 3);
+
+    auto const copy = std::string(GridCellsVertex());
+    EXPECT_EQ(cache.get({150, copy, GridCellsFragment()}, factory), cells);
+    EXPECT_EQ(cache.statistics().hits, 1);
+
+    cache.clear();
+    cache.resetStatistics();
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.statistics().hits, 0);
+}
@@ -0,0 +1,196 @@
+//! @file TestRecordingRenderer.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <UI/Rendering/ComponentCommands.hpp>
+#include <UI/Rendering/RecordingRenderer.hpp>
+
+namespace {
+
+//! @brief Issue the commands of a hovered, pressed button through the command sequences that `Button` draws with.
+
+void drawPressedButton(ds::ui::Renderer& renderer, int const& fill, int const& rules, float const x, float const y) {
+    auto const origin = ds::ui::Point {x, y};
+    auto const offset = ds::ui::Point {0.0f, 0.0f};
+
+    auto const uniforms = ds::ui::commands::RuleUniforms {1.0f, {800.0f, 600.0f}, {20.0f, 20.0f}, {1, 1}};
+
+    ds::ui::commands::drawButtonFills(renderer, &fill, offset, origin, {0.3f, 0.8f, 0.6f}, {true, true, true});
+    ds::ui::commands::drawRuledGrid(renderer, &rules, offset, origin, uniforms, [&] {
+        ds::ui::commands::drawOutlineRules(renderer, &rules);
+    });
+}
+
+}
+
+TEST(RecordingRenderer, CountsDrawCallsStateChangesAndPushes) {
+    auto recorder = ds::ui::RecordingRenderer();
+    auto const fill = 0;
+    auto const rules = 0;
+
+    for (auto i = 0; i < 10; ++i) {
+        drawPressedButton(recorder, fill, rules, static_cast<float>(i) * 20.0f, 0.0f);
+    }
+
+    auto const& stats = recorder.statistics();
+    EXPECT_EQ(stats.drawCalls, 30);
+    EXPECT_EQ(stats.stateChanges, 70);
+    EXPECT_EQ(stats.transformPushes, 20);
+    EXPECT_EQ(stats.maximumDepth, 1);
+    EXPECT_EQ(stats.unbalancedPops, 0);
+    EXPECT_EQ(recorder.count(ds::ui::RenderCommand::Type::DrawBatch), 30);
+    EXPECT_EQ(recorder.count(ds::ui::RenderCommand::Type::Uniform), 40);
+    EXPECT_EQ(recorder.getCommands().size(), 180);
+
+    recorder.clear();
+    EXPECT_TRUE(recorder.getCommands().empty());
+    EXPECT_EQ(recorder.statistics().drawCalls, 0);
+}
+
+TEST(RecordingRenderer, IdleButtonsDrawOnlyTheirOutline) {
+    auto recorder = ds::ui::RecordingRenderer();
+    auto const fill = 0;
+
+    ds::ui::commands::drawButtonFills(recorder, &fill, {0.0f, 0.0f}, {10.0f, 10.0f}, {}, {false, false, false});
+    EXPECT_TRUE(recorder.getCommands().empty());
+
+    ds::ui::commands::drawButtonFills(recorder, &fill, {5.0f, 0.0f}, {10.0f, 10.0f}, {}, {true, false, false});
+    EXPECT_EQ(recorder.statistics().drawCalls, 1);
+    EXPECT_FLOAT_EQ(recorder.getCommands()[4].x, 15.0f);
+}
+
+TEST(RecordingRenderer, RecordsTheTransformOfEachDraw) {
+    auto recorder = ds::ui::RecordingRenderer();
+    ds::ui::Renderer& renderer = recorder;
+    auto const batch = 0;
+    auto const texture = 0;
+
+    renderer.pushTransform();
+    renderer.translate(10.0f, 20.0f);
+    renderer.pushTransform();
+    renderer.scale(2.0f, 4.0f);
+    renderer.translate(1.0f, 1.0f);
+    renderer.drawInstanced(&batch, 64);
+    renderer.popTransform();
+    renderer.drawBatch(&batch, 4, 8, &texture);
+    renderer.popTransform();
+    renderer.popTransform();
+
+    auto const& commands = recorder.getCommands();
+    auto const& instanced = commands[5];
+    EXPECT_EQ(instanced.type, ds::ui::RenderCommand::Type::DrawInstanced);
+    EXPECT_FLOAT_EQ(instanced.x, 12.0f);
+    EXPECT_FLOAT_EQ(instanced.y, 24.0f);
+    EXPECT_FLOAT_EQ(instanced.scaleY, 4.0f);
+    EXPECT_EQ(instanced.count, 64);
+
+    auto const& ranged = commands[7];
+    EXPECT_EQ(ranged.type, ds::ui::RenderCommand::Type::DrawBatch);
+    EXPECT_FLOAT_EQ(ranged.x, 10.0f);
+    EXPECT_FLOAT_EQ(ranged.scaleX, 1.0f);
+    EXPECT_EQ(ranged.first, 4);
+    EXPECT_EQ(ranged.texture, &texture);
+
+    auto const& stats = recorder.statistics();
+    EXPECT_EQ(stats.instances, 64);
+    EXPECT_EQ(stats.maximumDepth, 2);
+    EXPECT_EQ(stats.unbalancedPops, 1);
+}
+
+TEST(RecordingRenderer, InstalledRendererIsScoped) {
+    auto recorder = ds::ui::RecordingRenderer();
+    EXPECT_EQ(ds::ui::Renderer::getInstalled(), nullptr);
+
+    {
+        auto const scopedRenderer = ds::ui::ScopedRenderer(recorder);
+        EXPECT_EQ(ds::ui::Renderer::getInstalled(), &recorder);
+    }
+
+    EXPECT_EQ(ds::ui::Renderer::getInstalled(), nullptr);
+}
+
+TEST(RecordingRenderer, RecordsTheCulledRangeOfADotGrid) {
+    auto recorder = ds::ui::RecordingRenderer();
+    auto const cells = 0;
+    auto const position = ds::ui::Point {-500.0f, 30.0f};
+    auto const spacing = ds::ui::Size {10.0f, 10.0f};
+    auto const visibleCells = ds::ui::getVisibleCells(position, spacing, {100, 100}, {0.0f, 0.0f, 95.0f, 95.0f});
+
+    ds::ui::commands::drawDotGrid(recorder, &cells, position, spacing, visibleCells, 3.0f);
+
+    auto const& commands = recorder.getCommands();
+    ASSERT_EQ(recorder.count(ds::ui::RenderCommand::Type::Uniform), 4);
+
+    auto const& firstCell = commands[4];
+    EXPECT_STREQ(firstCell.name, "gridFirstCell");
+    EXPECT_EQ(firstCell.resource, &cells);
+    EXPECT_EQ(firstCell.value, (ds::ui::UniformValue {visibleCells.column, visibleCells.row}));
+    EXPECT_EQ(commands[5].value, ds::ui::UniformValue(visibleCells.columns));
+
+    auto const& draw = commands[7];
+    EXPECT_EQ(draw.type, ds::ui::RenderCommand::Type::DrawInstanced);
+    EXPECT_EQ(draw.count, visibleCells.count());
+    EXPECT_LT(draw.count, 100 * 100);
+
+    recorder.clear();
+    ds::ui::commands::drawDotGrid(recorder, &cells, {0.0f, 0.0f}, spacing, {0, 0, 0, 4}, 3.0f);
+    EXPECT_TRUE(recorder.getCommands().empty());
+}
+
+TEST(RecordingRenderer, RecordsTheUniformsOfARuledGrid) {
+    auto recorder = ds::ui::RecordingRenderer();
+    auto const rules = 0;
+    auto const uniforms = ds::ui::commands::RuleUniforms {1.5f, {800.0f, 600.0f}, {20.0f, 10.0f}, {8, 4}};
+
+    ds::ui::commands::drawRuledGrid(recorder, &rules, {5.0f, 5.0f}, {10.0f, 20.0f}, uniforms, [&] {
+        recorder.drawBatch(&rules, 0, 10, nullptr);
+        recorder.drawBatch(&rules, 64, 18, nullptr);
+    });
+
+    auto const& commands = recorder.getCommands();
+    ASSERT_EQ(recorder.count(ds::ui::RenderCommand::Type::Uniform), 4);
+    EXPECT_EQ(recorder.statistics().drawCalls, 2);
+    EXPECT_EQ(recorder.statistics().stateChanges, 4);
+
+    EXPECT_STREQ(commands[4].name, "LineThickness");
+    EXPECT_EQ(commands[4].resource, &rules);
+    EXPECT_EQ(commands[4].value, ds::ui::UniformValue {1.5f});
+    EXPECT_STREQ(commands[5].name, "ViewportScale");
+    EXPECT_EQ(commands[5].value, (ds::ui::UniformValue {800.0f, 600.0f}));
+    EXPECT_STREQ(commands[6].name, "gridSpacing");
+    EXPECT_EQ(commands[6].value, (ds::ui::UniformValue {20.0f, 10.0f}));
+    EXPECT_STREQ(commands[7].name, "gridDimensions");
+    EXPECT_EQ(commands[7].value, (ds::ui::UniformValue {8.0f, 4.0f}));
+
+    EXPECT_EQ(commands[8].type, ds::ui::RenderCommand::Type::DrawBatch);
+    EXPECT_FLOAT_EQ(commands[8].x, 15.0f);
+    EXPECT_FLOAT_EQ(commands[8].y, 25.0f);
+}
+
+TEST(RecordingRenderer, RecordsTheUniformsOfAnAnalyticGrid) {
+    auto recorder = ds::ui::RecordingRenderer();
+    auto const quad = 0;
+    auto const spacing = ds::ui::Size {20.0f, 10.0f};
+    auto const dimensions = ds::ui::Size {8, 4};
+
+    ds::ui::commands::drawAnalyticGrid(recorder, &quad, {5.0f, 5.0f}, {10.0f, 20.0f}, spacing, dimensions, 1.0f);
+
+    auto const& commands = recorder.getCommands();
+    ASSERT_EQ(recorder.count(ds::ui::RenderCommand::Type::Uniform), 4);
+    EXPECT_EQ(recorder.statistics().drawCalls, 1);
+
+    auto const extent = ds::ui::getGridLineExtent(spacing, dimensions, 1.0f);
+    EXPECT_STREQ(commands[4].name, "gridExtent");
+    EXPECT_EQ(commands[4].value, (ds::ui::UniformValue {extent.origin().x, extent.origin().y,
+                                                        extent.size().w, extent.size().h}));
+    EXPECT_EQ(commands[6].value, (ds::ui::UniformValue {8.0f, 4.0f}));
+
+    auto const& draw = commands[8];
+    EXPECT_EQ(draw.type, ds::ui::RenderCommand::Type::DrawBatch);
+    EXPECT_EQ(draw.resource, &quad);
+    EXPECT_FLOAT_EQ(draw.x, 15.0f);
+    EXPECT_FLOAT_EQ(draw.y, 25.0f);
+}
@@ -0,0 +1,204 @@
+//! @file TestSceneGraph.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <UI/SceneGraph.hpp>
+
+namespace {
+
+struct SceneComponent: public ds::ui::Component {
+    SceneComponent(float const x, float const y, float const width, float const height):
+            ds::ui::Component(width, height) {
+        setPositionWithOrigin(x, y);
+    }
+
+    void draw(float const offsetX, float const offsetY) override {
+        ++drawCount;
+    }
+
+    int drawCount {0};
+};
+
+std::vector<ds::ui::Bounds<float>> getSortedRegions(std::vector<ds::ui::Bounds<float>> regions) {
+    std::sort(regions.begin(), regions.end(), [](auto const& a, auto const& b) {
+        return a.origin().x < b.origin().x or (a.origin().x == b.origin().x and a.origin().y < b.origin().y);
+    });
+
+    return regions;
+}
+
+void expectBounds(ds::ui::Bounds<float> const& bounds, float x, float y, float width, float height) {
+    EXPECT_FLOAT_EQ(bounds.origin().x, x);
+    EXPECT_FLOAT_EQ(bounds.origin().y, y);
+    EXPECT_FLOAT_EQ(bounds.size().w, width);
+    EXPECT_FLOAT_EQ(bounds.size().h, height);
+}
+
+}
+
+TEST(SceneGraph, FirstUpdateDamagesViewport) {
+    auto graph = ds::ui::SceneGraph({0.0f, 0.0f, 800.0f, 600.0f});
+    auto component = SceneComponent(10.0f, 10.0f, 50.0f, 50.0f);
+    graph.add(component);
+
+    auto const& regions = graph.update();
+    ASSERT_EQ(regions.size(), 1);
+    expectBounds(regions.front(), 0.0f, 0.0f, 800.0f, 600.0f);
+
+    EXPECT_TRUE(graph.update().empty());
+}
+
+TEST(SceneGraph, ChildrenAreRelativeToTheirParent) {
+    auto graph = ds::ui::SceneGraph({0.0f, 0.0f, 800.0f, 600.0f});
+    auto parent = SceneComponent(100.0f, 100.0f, 200.0f, 200.0f);
+    auto child = SceneComponent(10.0f, 20.0f, 30.0f, 30.0f);
+
+    auto const parentNode = graph.add(parent);
+    auto const childNode = graph.add(child, parentNode);
+    graph.update();
+
+    expectBounds(graph.getAbsoluteBounds(childNode), 110.0f, 120.0f, 30.0f, 30.0f);
+
+    parent.translate(50.0f, 0.0f);
+    graph.update();
+
+    expectBounds(graph.getAbsoluteBounds(childNode), 160.0f, 120.0f, 30.0f, 30.0f);
+}
+
+TEST(SceneGraph, MovingAComponentDamagesOldAndNewBounds) {
+    auto graph = ds::ui::SceneGraph({0.0f, 0.0f, 800.0f, 600.0f});
+    auto component = SceneComponent(10.0f, 10.0f, 20.0f, 20.0f);
+    graph.add(component);
+    graph.update();
+
+    component.setPositionWithOrigin(400.0f, 300.0f);
+
+    auto const regions = getSortedRegions(graph.update());
+    ASSERT_EQ(regions.size(), 2);
+    expectBounds(regions[0], 10.0f, 10.0f, 20.0f, 20.0f);
+    expectBounds(regions[1], 400.0f, 300.0f, 20.0f, 20.0f);
+}
+
+TEST(SceneGraph, AdjacentRegionsAreMerged) {
+    auto graph = ds::ui::SceneGraph({0.0f, 0.0f, 800.0f, 600.0f});
+    auto a = SceneComponent(0.0f, 0.0f, 20.0f, 20.0f);
+    auto b = SceneComponent(20.0f, 0.0f, 20.0f, 20.0f);
+    auto c = SceneComponent(500.0f, 500.0f, 20.0f, 20.0f);
+    graph.add(a);
+    graph.add(b);
+    graph.add(c);
+    graph.update();
+
+    a.setShouldRedraw(true);
+    b.setShouldRedraw(true);
+    c.setShouldRedraw(true);
+
+    auto const regions = getSortedRegions(graph.update());
+    ASSERT_EQ(regions.size(), 2);
+    expectBounds(regions[0], 0.0f, 0.0f, 40.0f, 20.0f);
+    expectBounds(regions[1], 500.0f, 500.0f, 20.0f, 20.0f);
+}
+
+TEST(SceneGraph, RegionCountIsLimited) {
+    auto graph = ds::ui::SceneGraph({0.0f, 0.0f, 800.0f, 600.0f}, 2);
+    auto components = std::vector<SceneComponent>();
+    for (auto i = 0; i < 5; ++i) {
+        components.emplace_back(static_cast<float>(i) * 100.0f, 0.0f, 10.0f, 10.0f);
+    }
+
+    for (auto& component: components) {
+        graph.add(component);
+    }
+
+    graph.update();
+
+    for (auto& component: components) {
+        component.setShouldRedraw(true);
+    }
+
+    auto const& regions = graph.update();
+    ASSERT_EQ(regions.size(), 2);
+
+    for (auto const& component: components) {
+        auto const isCovered = std::any_of(regions.begin(), regions.end(), [&](auto const& region) {
+            return region.contains(component.origin()) and region.contains(component.getLowerRight());
+        });
+
+        EXPECT_TRUE(isCovered);
+    }
+}
+
+TEST(SceneGraph, RegionsAreClippedToViewport) {
+    auto graph = ds::ui::SceneGraph({0.0f, 0.0f, 100.0f, 100.0f});
+    auto inside = SceneComponent(90.0f, 90.0f, 20.0f, 20.0f);
+    auto outside = SceneComponent(200.0f, 200.0f, 20.0f, 20.0f);
+    graph.add(inside);
+    graph.add(outside);
+    graph.update();
+
+    inside.setShouldRedraw(true);
+    outside.setShouldRedraw(true);
+
+    auto const& regions = graph.update();
+    ASSERT_EQ(regions.size(), 1);
+    expectBounds(regions.front(), 90.0f, 90.0f, 10.0f, 10.0f);
+}
+
+TEST(SceneGraph, RemovalDamagesSubtree) {
+    auto graph = ds::ui::SceneGraph({0.0f, 0.0f, 800.0f, 600.0f});
+    auto parent = SceneComponent(100.0f, 100.0f, 20.0f, 20.0f);
+    auto child = SceneComponent(30.0f, 0.0f, 20.0f, 20.0f);
+
+    auto const parentNode = graph.add(parent);
+    graph.add(child, parentNode);
+    graph.update();
+    EXPECT_EQ(graph.size(), 2);
+
+    graph.remove(parentNode);
+    EXPECT_EQ(graph.size(), 0);
+
+    auto const& regions = graph.update();
+    ASSERT_EQ(regions.size(), 1);
+    expectBounds(regions.front(), 100.0f, 100.0f, 50.0f, 20.0f);
+}
+
+TEST(SceneGraph, DrawSkipsSubtreesOutsideRegion) {
+    auto graph = ds::ui::SceneGraph({0.0f, 0.0f, 800.0f, 600.0f});
+    auto left = SceneComponent(0.0f, 0.0f, 100.0f, 100.0f);
+    auto leftChild = SceneComponent(10.0f, 10.0f, 10.0f, 10.0f);
+    auto right = SceneComponent(400.0f, 0.0f, 100.0f, 100.0f);
+    auto rightChild = SceneComponent(10.0f, 10.0f, 10.0f, 10.0f);
+
+    graph.add(leftChild, graph.add(left));
+    graph.add(rightChild, graph.add(right));
+    graph.update();
+
+    right.setShouldRedraw(true);
+
+    auto visitCount = 0;
+    auto const& regions = graph.update();
+    for (auto const& region: regions) {
+        graph.visit(region, [&](ds::ui::Component& component, ds::ui::Point<float> const& offset) {
+            ++visitCount;
+
+            if (&component == &rightChild) {
+                EXPECT_EQ(offset, right.origin());
+            }
+        });
+
+        graph.draw(region);
+    }
+
+    EXPECT_EQ(visitCount, 2);
+    EXPECT_EQ(left.drawCount, 0);
+    EXPECT_EQ(leftChild.drawCount, 0);
+    EXPECT_EQ(right.drawCount, 1);
+    EXPECT_EQ(rightChild.drawCount, 1);
+    EXPECT_FALSE(right.getShouldRedraw());
+    EXPECT_TRUE(graph.update().empty());
+}
@@ -0,0 +1,81 @@
+//! @file TestTextLayout.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <UI/Geometry/TextLayout.hpp>
+
+namespace {
+
+//! @brief Produce monospaced metrics for the digits, the decimal point and '?', each in its own atlas cell.
+
+ds::ui::GlyphMetrics getTestGlyphMetrics() {
+    auto metrics = ds::ui::GlyphMetrics(16.0f);
+    auto cell = 0.0f;
+
+    for (auto const character: {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '.', '?'}) {
+        auto const advance = character == '.' ? 4.0f : 8.0f;
+        metrics.setGlyph(character, {advance, 0.0f, 2.0f, advance, 12.0f, cell / 16.0f, 0.0f, (cell + 1.0f) / 16.0f, 1.0f});
+        cell = cell + 1.0f;
+    }
+
+    return metrics;
+}
+
+}
+
+TEST(TextLayout, LaysOutQuadsAlongTheBaseline) {
+    auto const metrics = getTestGlyphMetrics();
+    auto layout = ds::ui::TextLayout(metrics);
+
+    EXPECT_TRUE(layout.setText("1.5", 100.0f));
+    EXPECT_FLOAT_EQ(layout.getTextWidth(), 20.0f);
+    EXPECT_FLOAT_EQ(layout.getTextHeight(), 16.0f);
+
+    auto const& vertices = layout.getVertices();
+    ASSERT_EQ(vertices.size(), 18);
+    EXPECT_EQ(vertices[0], (ds::ui::GlyphVertex {0.0f, 2.0f, 1.0f / 16.0f, 0.0f}));
+    EXPECT_EQ(vertices[2], (ds::ui::GlyphVertex {8.0f, 14.0f, 2.0f / 16.0f, 1.0f}));
+    EXPECT_FLOAT_EQ(vertices[6].x, 8.0f);
+    EXPECT_FLOAT_EQ(vertices[12].x, 12.0f);
+    EXPECT_FLOAT_EQ(vertices[13].x, 20.0f);
+}
+
+TEST(TextLayout, AlignsTextWithinItsBox) {
+    auto const metrics = getTestGlyphMetrics();
+    auto layout = ds::ui::TextLayout(metrics);
+
+    layout.setText("12", 60.0f, ds::ui::TextAlignment::Centre);
+    EXPECT_FLOAT_EQ(layout.getVertices()[0].x, 22.0f);
+
+    layout.setText("12", 60.0f, ds::ui::TextAlignment::Right);
+    EXPECT_FLOAT_EQ(layout.getVertices()[0].x, 44.0f);
+}
+
+TEST(TextLayout, ChangingOneDigitRewritesOneQuad) {
+    auto const metrics = getTestGlyphMetrics();
+    auto layout = ds::ui::TextLayout(metrics);
+    layout.setText("10.25", 60.0f, ds::ui::TextAlignment::Centre);
+
+    EXPECT_TRUE(layout.setText("10.26", 60.0f, ds::ui::TextAlignment::Centre));
+    EXPECT_EQ(layout.getDirtyRange().first, 24);
+    EXPECT_EQ(layout.getDirtyRange().count, 6);
+
+    EXPECT_FALSE(layout.setText("10.26", 60.0f, ds::ui::TextAlignment::Centre));
+    EXPECT_EQ(layout.getDirtyRange().count, 0);
+
+    EXPECT_TRUE(layout.setText("10.2", 60.0f, ds::ui::TextAlignment::Left));
+    EXPECT_EQ(layout.getVertices().size(), 24);
+}
+
+TEST(TextLayout, MissingGlyphsFallBackToTheQuestionMark) {
+    auto const metrics = getTestGlyphMetrics();
+    auto layout = ds::ui::TextLayout(metrics);
+
+    EXPECT_FALSE(metrics.hasGlyph('x'));
+    layout.setText("x", 100.0f);
+    EXPECT_FLOAT_EQ(layout.getVertices()[0].u, 11.0f / 16.0f);
+    EXPECT_FLOAT_EQ(metrics.measure("x1"), 16.0f);
+}
@@ -0,0 +1,123 @@
+//! @file TestWorkStealingPool.hpp
+//! @date 17/10/26
+//! @author David Spry
+
+#pragma once
+
+#include <atomic>
+#include <future>
+#include <vector>
+#include <stdexcept>
+#include <gtest/gtest.h>
+#include <Concurrency/PendingResult.hpp>
+#include <Concurrency/WorkStealingPool.hpp>
+#include <UI/Geometry/GridLines.hpp>
+
+namespace {
+
+bool isSameGeometry(std::vector<ds::ui::GridLineVertex> const& a, std::vector<ds::ui::GridLineVertex> const& b) {
+    return std::equal(a.cbegin(), a.cend(), b.cbegin(), b.cend(), [](auto const& u, auto const& v) {
+        return u.orientation == v.orientation and u.index == v.index and u.end == v.end and u.anchor == v.anchor;
+    });
+}
+
+}
+
+TEST(WorkStealingPool, RunsEachTaskAndReturnsItsResult) {
+    auto pool = ds::concurrency::WorkStealingPool(4);
+    std::vector<std::future<int>> results;
+
+    for (auto i = 0; i < 1000; ++i) {
+        results.push_back(pool.submit([i] { return i * i; }));
+    }
+
+    for (auto i = 0; i < 1000; ++i) {
+        ASSERT_EQ(results[i].get(), i * i);
+    }
+}
+
+TEST(WorkStealingPool, IdleWorkersStealQueuedTasks) {
+    auto pool = ds::concurrency::WorkStealingPool(4);
+
+    // The parent task queues its children on its own worker and then blocks, so only other workers can run them.
+
+    auto parent = pool.submit([&pool] {
+        std::vector<std::future<int>> children;
+        for (auto i = 0; i < 16; ++i) {
+            children.push_back(pool.submit([i] { return i; }));
+        }
+
+        auto total = 0;
+        for (auto& child: children) {
+            total = total + child.get();
+        }
+
+        return total;
+    });
+
+    ASSERT_EQ(parent.get(), 120);
+    ASSERT_GE(pool.getStolenTaskCount(), 16);
+}
+
+TEST(WorkStealingPool, PropagatesExceptions) {
+    auto pool = ds::concurrency::WorkStealingPool(2);
+    auto result = pool.submit([]() -> int { throw std::runtime_error("failed"); });
+
+    ASSERT_THROW(result.get(), std::runtime_error);
+}
+
+TEST(WorkStealingPool, FinishesQueuedTasksBeforeStopping) {
+    std::atomic<int> finished {0};
+
+    {
+        auto pool = ds::concurrency::WorkStealingPool(2);
+        for (auto i = 0; i < 200; ++i) {
+            pool.submit([&finished] { finished.fetch_add(1); });
+        }
+    }
+
+    ASSERT_EQ(finished.load(), 200);
+}
+
+TEST(PendingResult, DiscardsSupersededResults) {
+    auto pool = ds::concurrency::WorkStealingPool(2);
+    auto pending = ds::concurrency::PendingResult<int>();
+    ASSERT_FALSE(pending.take().has_value());
+
+    pending.request(pool, [] { return 1; });
+    pending.request(pool, [] { return 2; });
+    ASSERT_TRUE(pending.isPending());
+    ASSERT_EQ(pending.wait(), 2);
+    ASSERT_FALSE(pending.isPending());
+
+    pending.request(pool, [] { return 3; });
+    pending.cancel();
+    ASSERT_FALSE(pending.wait().has_value());
+}
+
+TEST(GridLineGeneration, MatchesTheBufferWrittenOnTheRenderThread) {
+    auto pool = ds::concurrency::WorkStealingPool(4);
+
+    for (auto n = 1; n <= 64; n = n * 2 + 1) {
+        auto synchronous = ds::ui::GridLineBuffer(2, 3);
+        auto asynchronous = ds::ui::GridLineBuffer(2, 3);
+
+        auto const layout = asynchronous.getReallocation(n, n + 5);
+        ASSERT_TRUE(layout.has_value());
+
+        auto pending = ds::concurrency::PendingResult<ds::ui::GridLineGeometry>();
+        pending.request(pool, [layout = *layout] { return ds::ui::generateGridLines(layout); });
+        asynchronous.adopt(std::move(*pending.wait()));
+
+        ASSERT_TRUE(synchronous.setDimensions(n, n + 5));
+        ASSERT_TRUE(isSameGeometry(asynchronous.getVertices(), synchronous.getVertices()));
+        ASSERT_EQ(asynchronous.getRows(), n);
+        ASSERT_EQ(asynchronous.getColumns(), n + 5);
+        ASSERT_EQ(asynchronous.getDirtyRanges().size(), synchronous.getDirtyRanges().size());
+
+        // Resizing within the adopted capacity continues incrementally, as it would after a synchronous resize.
+
+        ASSERT_FALSE(asynchronous.getReallocation(n - 1, n).has_value());
+        ASSERT_FALSE(asynchronous.setDimensions(n - 1, n));
+    }
+}